@@ -54,7 +54,7 @@
 // This is for windows.  Even though we #include config.h, just like
 // the files used to compile the dll, we are actually a *client* of
 // the dll, so we don't get to decl anything.
-#include <config.h>
+#include <config_ctemplate.h>
 #undef CTEMPLATE_DLL_DECL
 #include <ctype.h>    // for toupper(), isalnum()
 #include <errno.h>
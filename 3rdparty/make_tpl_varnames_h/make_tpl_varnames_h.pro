@@ -0,0 +1,36 @@
+# generator of headers with the variable names of templates (used by src.pro)
+QT -= core gui
+TARGET = make_tpl_varnames_h
+OBJECTS_DIR = build
+TEMPLATE = app
+CONFIG += console
+CONFIG -= qt app_bundle
+
+SOURCES += ../ctemplate/make_tpl_varnames_h.cc \
+    ../ctemplate/base/arena.cc \
+    ../ctemplate/htmlparser/htmlparser.cc \
+    ../ctemplate/htmlparser/jsparser.cc \
+    ../ctemplate/htmlparser/statemachine.cc \
+    ../ctemplate/per_expand_data.cc \
+    ../ctemplate/template_annotator.cc \
+    ../ctemplate/template_cache.cc \
+    ../ctemplate/template.cc \
+    ../ctemplate/template_dictionary.cc \
+    ../ctemplate/template_modifiers.cc \
+    ../ctemplate/template_namelist.cc \
+    ../ctemplate/template_pathops.cc \
+    ../ctemplate/template_string.cc
+
+linux-g++|linux-g++-64|linux-g++-32 {
+    INCLUDEPATH += ../ctemplate \
+            ../ctemplate/unix \
+            ..
+    LIBS += -lpthread
+}
+
+win32-msvc2010 {
+    INCLUDEPATH += ../ctemplate
+    INCLUDEPATH += ../ctemplate/windows
+
+    SOURCES += ../ctemplate/windows/port.cc
+}
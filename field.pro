@@ -1,4 +1,5 @@
 SUBDIRS += 3rdparty
+SUBDIRS += 3rdparty/make_tpl_varnames_h
 SUBDIRS += src
 SUBDIRS += binary
 
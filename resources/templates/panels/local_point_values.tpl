@@ -20,13 +20,13 @@
 	<tr>
 		<td class="description"><b>Point</b></td>
 		<td class="quantity">{{LABELX}}</td>
-		<td>{{POINTX}}</td>
+		<td id="point_x">{{POINTX}}</td>
 		<td class="unit">{{POINT_UNIT}}</td>
 	</tr>
 	<tr>
 		<td class="description">&nbsp;</td>
 		<td class="quantity">{{LABELY}}</td>
-		<td>{{POINTY}}</td>
+		<td id="point_y">{{POINTY}}</td>
 		<td class="unit">{{POINT_UNIT}}</td>
 	</tr>
 </table>
@@ -38,7 +38,7 @@
 	<tr>
 		<td class="description"><b>{{NAME}}<b></td>
 		<td class="quantity">{{SHORTNAME}}<sub>{{PART}}</sub></td>
-		<td>{{VALUE}}</td>
+		<td id="value_{{ID}}">{{VALUE}}</td>
 		<td class="unit">{{UNIT}}</td>
 	</tr>
 	{{/ITEM}}
@@ -42,6 +42,19 @@ cdef extern from "../../src/pythonlabagros.h":
 
     void pySaveImage(char *str, int w, int h) except +
 
+    void pyLocalValues(vector[double] &x, vector[double] &y, vector[double] &z, vector[double] &values, char *quantity) except +
+
+    void pyLineValues(vector[double] &start, vector[double] &end, int count, char *quantity, vector[double] &lengths, vector[double] &values) except +
+
+    void pyTimeHistory(vector[double] &x, vector[double] &y, vector[double] &z, vector[double] &times, vector[double] &values) except +
+
+    void pyDerivedQuantity(char *name, char *expression) except +
+    void pyRemoveDerivedQuantity(char *name)
+
+    void pyIntegrals(int dimension, vector[double] &values) except +
+
+    int pyAddNodes(char *generator, vector[double] &parameters) except +
+
 # Problem
 cdef class __Problem__:
     cdef PyProblem *thisptr
@@ -106,3 +119,129 @@ def close_document():
 
 def save_image(char *str, int w = 0, int h = 0):
     pySaveImage(str, w, h)
+
+# local_values([(x, y, z), ...], quantity = ""), z is optional, quantity is a derived quantity
+def local_values(points, char *quantity = ""):
+    cdef vector[double] x
+    cdef vector[double] y
+    cdef vector[double] z
+    cdef vector[double] values
+
+    for point in points:
+        x.push_back(point[0])
+        y.push_back(point[1])
+        z.push_back(point[2] if len(point) > 2 else 0.0)
+
+    pyLocalValues(x, y, z, values, quantity)
+
+    return [values[i] for i in range(values.size())]
+
+# local_value(x, y, z, quantity = "")
+def local_value(double x, double y, double z = 0.0, char *quantity = ""):
+    return local_values([(x, y, z)], quantity)[0]
+
+# derived_quantity(name, expression), expression of x, y, z, V, Ex, Ey, Ez and E
+def derived_quantity(char *name, char *expression):
+    pyDerivedQuantity(name, expression)
+
+def remove_derived_quantity(char *name):
+    pyRemoveDerivedQuantity(name)
+
+def __integrals__(int dimension, names):
+    cdef vector[double] values
+    pyIntegrals(dimension, values)
+
+    return dict([(names[i], values[i]) for i in range(values.size())])
+
+# line_integrals(), polyline through the selected nodes
+def line_integrals():
+    return __integrals__(1, ["length", "potential", "voltage"])
+
+# surface_integrals(), fan of triangles around the first selected node
+def surface_integrals():
+    return __integrals__(2, ["area", "potential", "flux"])
+
+# volume_integrals(), strip of tetrahedra around the first selected node
+def volume_integrals():
+    return __integrals__(3, ["volume", "potential", "energy"])
+
+def __add_nodes__(char *generator, parameters):
+    cdef vector[double] p
+    for parameter in parameters:
+        p.push_back(parameter)
+
+    return pyAddNodes(generator, p)
+
+def __point__(point):
+    return [point[0], point[1], point[2] if len(point) > 2 else 0.0]
+
+# generators add all nodes at once (one undo step), nodes coincident with existing nodes are skipped,
+# they return the number of added nodes, points are (x, y, z) with optional z, angles are in degrees
+
+# add_lattice(origin, step, counts), counts (nx, ny, nz)
+def add_lattice(origin, step, counts):
+    return __add_nodes__("lattice", __point__(origin) + __point__(step) + list(counts))
+
+# add_polar(center, r0, r1, nr, na, angle = 0), nr rings from r0 to r1 with na points in the plane z = center z
+def add_polar(center, double r0, double r1, int nr, int na, double angle = 0.0):
+    return __add_nodes__("polar", __point__(center) + [r0, r1, nr, na, angle])
+
+# add_cylindrical(center, r0, r1, nr, na, dz, nz, angle = 0), polar array repeated nz times along z
+def add_cylindrical(center, double r0, double r1, int nr, int na, double dz, int nz, double angle = 0.0):
+    return __add_nodes__("cylindrical", __point__(center) + [r0, r1, nr, na, dz, nz, angle])
+
+# add_line(start, end, count), both end points included
+def add_line(start, end, int count):
+    return __add_nodes__("line", __point__(start) + __point__(end) + [count])
+
+# add_circle(center, radius, count, normal = (0, 0, 1))
+def add_circle(center, double radius, int count, normal = (0.0, 0.0, 1.0)):
+    return __add_nodes__("circle", __point__(center) + __point__(normal) + [radius, count])
+
+# add_helix(center, radius, pitch, turns, count), axis z, pitch is the rise per turn
+def add_helix(center, double radius, double pitch, double turns, int count):
+    return __add_nodes__("helix", __point__(center) + [radius, pitch, turns, count])
+
+# add_plane(origin, u, v, nu, nv), parallelogram origin + s u + t v, s and t from 0 to 1
+def add_plane(origin, u, v, int nu, int nv):
+    return __add_nodes__("plane", __point__(origin) + __point__(u) + __point__(v) + [nu, nv])
+
+# add_sphere(center, radius, count), evenly distributed points
+def add_sphere(center, double radius, int count):
+    return __add_nodes__("sphere", __point__(center) + [radius, count])
+
+# line_values(start, end, count = 0, quantity = ""), [(distance from start, value), ...] adaptively sampled along the line,
+# count limits the number of points (default of the chart if zero), values outside the solution are zero
+def line_values(start, end, int count = 0, char *quantity = ""):
+    cdef vector[double] s
+    cdef vector[double] e
+    cdef vector[double] lengths
+    cdef vector[double] values
+
+    for coordinate in __point__(start):
+        s.push_back(coordinate)
+    for coordinate in __point__(end):
+        e.push_back(coordinate)
+
+    pyLineValues(s, e, count, quantity, lengths, values)
+
+    return [(lengths[i], values[i]) for i in range(values.size())]
+
+# time_history(points), (times, [[value in all times] for each point]) for all time levels of the last solve,
+# points are (x, y, z) with optional z, values outside the solution of a time level are NaN
+def time_history(points):
+    cdef vector[double] x
+    cdef vector[double] y
+    cdef vector[double] z
+    cdef vector[double] times
+    cdef vector[double] values
+
+    for point in points:
+        x.push_back(point[0])
+        y.push_back(point[1])
+        z.push_back(point[2] if len(point) > 2 else 0.0)
+
+    pyTimeHistory(x, y, z, times, values)
+
+    return ([times[i] for i in range(times.size())],
+            [[values[i * times.size() + j] for j in range(times.size())] for i in range(x.size())])
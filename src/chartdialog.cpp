@@ -26,29 +26,28 @@
 #include "gui/chart.h"
 #include "gui/common.h"
 
-/*
 QList<Point3> ChartLine::getPoints()
 {
     if (numberOfPoints == 0)
         return QList<Point3>();
 
-    QList<Point3> points;
+    if (numberOfPoints == 1)
+        return QList<Point3>() << (reverse ? end : start);
 
+    QList<Point3> points;
     points.reserve(numberOfPoints);
 
-    double dx = (end.x - start.x) / (numberOfPoints - 1);
-    double dy = (end.y - start.y) / (numberOfPoints - 1);
-    double dz = (end.z - start.z) / (numberOfPoints - 1);
+    // reversed line is generated from the end
+    Point3 from = reverse ? end : start;
+    Point3 step = ((reverse ? start : end) - from) / (numberOfPoints - 1);
 
     for (int i = 0; i < numberOfPoints; i++)
-        if (reverse)
-            points.insert(0, Point3(start.x + i*dx, start.y + i*dy, start.z + i*dz));
-        else
-            points.append(Point3(start.x + i*dx, start.y + i*dy, start.z + i*dz));
+        points.append(from + step * i);
 
     return points;
 }
 
+/*
 // **************************************************************************************************
 
 ChartDialog::ChartDialog(SceneViewPost3D *sceneView,
@@ -41,7 +41,7 @@ struct ChartLine
     int numberOfPoints;
     bool reverse;
 
-    ChartLine() : start(Point3()), end(end), numberOfPoints(0), reverse(false) {}
+    ChartLine() : start(Point3()), end(Point3()), numberOfPoints(0), reverse(false) {}
 
     ChartLine(Point3 start, Point3 end, int numberOfPoints = 200, bool reverse = false)
     {
@@ -51,6 +51,7 @@ struct ChartLine
         this->reverse = reverse;
     }
 
+    /// uniformly distributed points, adaptive sampling is provided by LineSampler
     QList<Point3> getPoints();
 };
 
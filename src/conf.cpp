@@ -73,6 +73,7 @@ void Config::loadWorkspace()
 
     // geometry
     nodeSize = settings.value("SceneViewSettings/NodeSize", GEOMETRYNODESIZE).toDouble();
+    geometryTolerance = settings.value("Geometry/Tolerance", SCENEVALIDATIONTOLERANCE).toDouble();
 
     // font
     sceneFont = settings.value("SceneViewSettings/SceneFont", FONT).value<QFont>();
@@ -95,6 +96,12 @@ void Config::loadPostprocessor(QDomElement *config)
 
     // view
     showPost3D = (SceneViewPost3DMode) readConfig("SceneViewSettings/ShowPost3D", (int) SCALARSHOWPOST3D);
+    isoSurfacesCount = readConfig("SceneViewSettings/IsoSurfacesCount", ISOSURFACESCOUNT);
+    scalarVariable = readConfig("SceneViewSettings/ScalarVariable", QString());
+
+    // particle tracing
+    particleNumberOfParticles = readConfig("SceneViewSettings/ParticleNumberOfParticles", PARTICLENUMBEROFPARTICLES);
+    particleMaximumSteps = readConfig("SceneViewSettings/ParticleMaximumSteps", PARTICLEMAXIMUMSTEPS);
 
     showScalarColorBar = readConfig("SceneViewSettings/ShowScalarColorBar", SHOWSCALARCOLORBAR);
     paletteType = (PaletteType) readConfig("SceneViewSettings/PaletteType", PALETTETYPE);
@@ -109,6 +116,11 @@ void Config::loadAdvanced()
     QSettings settings;
     // number of threads
 
+    // solver
+    solverProgressive = settings.value("Solver/Progressive", SOLVERPROGRESSIVE).toBool();
+    solverIncremental = settings.value("Solver/Incremental", SOLVERINCREMENTAL).toBool();
+    solverGridLevels = settings.value("Solver/GridLevels", SOLVERGRIDLEVELS).toInt();
+
     // global script
     globalScript = settings.value("Python/GlobalScript", "").toString();
 }
@@ -154,6 +166,7 @@ void Config::saveWorkspace()
 
     // geometry
     settings.setValue("SceneViewSettings/NodeSize", nodeSize);
+    settings.setValue("Geometry/Tolerance", geometryTolerance);
 
     // 3d
     settings.setValue("SceneViewSettings/ScalarView3DLighting", scalarView3DLighting);
@@ -169,6 +182,12 @@ void Config::savePostprocessor(QDomElement *config)
     writeConfig("SceneViewSettings/ActiveField", activeField);
 
     writeConfig("SceneViewSettings/ShowPost3D", showPost3D);
+    writeConfig("SceneViewSettings/IsoSurfacesCount", isoSurfacesCount);
+    writeConfig("SceneViewSettings/ScalarVariable", scalarVariable);
+
+    // particle tracing
+    writeConfig("SceneViewSettings/ParticleNumberOfParticles", particleNumberOfParticles);
+    writeConfig("SceneViewSettings/ParticleMaximumSteps", particleMaximumSteps);
 
     // scalar view
     writeConfig("SceneViewSettings/ShowScalarColorBar", showScalarColorBar);
@@ -183,6 +202,11 @@ void Config::saveAdvanced()
 {
     QSettings settings;
 
+    // solver
+    settings.setValue("Solver/Progressive", solverProgressive);
+    settings.setValue("Solver/Incremental", solverIncremental);
+    settings.setValue("Solver/GridLevels", solverGridLevels);
+
     // global script
     settings.setValue("Python/GlobalScript", globalScript);
 }
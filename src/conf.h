@@ -41,6 +41,8 @@ public:
 
     // geometry
     double nodeSize;
+    // nodes closer than the tolerance are duplicates (validation)
+    double geometryTolerance;
 
     // font
     QFont sceneFont;
@@ -55,6 +57,13 @@ public:
 
     // post3d
     SceneViewPost3DMode showPost3D;
+    int isoSurfacesCount;
+    // derived quantity shown by the scalar view (empty for the potential)
+    QString scalarVariable;
+
+    // particle tracing
+    int particleNumberOfParticles;
+    int particleMaximumSteps;
 
     // palette
     bool showScalarColorBar;
@@ -83,6 +92,11 @@ public:
     double scalarView3DAngle;
     bool scalarView3DBackground;
 
+    // solver
+    bool solverProgressive;
+    bool solverIncremental;
+    int solverGridLevels;
+
     // global script
     QString globalScript;
 
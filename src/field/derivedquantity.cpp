@@ -0,0 +1,134 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "derivedquantity.h"
+#include "solutiongrid.h"
+
+enum DerivedQuantityVariable
+{
+    DerivedQuantityVariable_X,
+    DerivedQuantityVariable_Y,
+    DerivedQuantityVariable_Z,
+    DerivedQuantityVariable_V,
+    DerivedQuantityVariable_Ex,
+    DerivedQuantityVariable_Ey,
+    DerivedQuantityVariable_Ez,
+    DerivedQuantityVariable_E
+};
+
+DerivedQuantity::DerivedQuantity(const QString &name, const QString &expression)
+    : m_name(name), m_expression(expression, variables()), m_grid(NULL), m_solutionRevision(0)
+{
+}
+
+DerivedQuantity::~DerivedQuantity()
+{
+    clear();
+}
+
+QStringList DerivedQuantity::variables()
+{
+    // in the order of DerivedQuantityVariable
+    return QStringList() << "x" << "y" << "z" << "V" << "Ex" << "Ey" << "Ez" << "E";
+}
+
+void DerivedQuantity::clear()
+{
+    delete m_grid;
+    m_grid = NULL;
+    m_solutionRevision = 0;
+}
+
+const SolutionGrid *DerivedQuantity::grid(const SolutionGrid *solution)
+{
+    if (m_grid && m_solutionRevision == solution->revision())
+        return m_grid;
+
+    clear();
+
+    int count = solution->count();
+    int nx = solution->nx();
+    int ny = solution->ny();
+
+    QVector<const double *> arguments(variables().count(), NULL);
+    arguments[DerivedQuantityVariable_V] = solution->values();
+
+    // coordinates
+    QVector<double> coordinates;
+    if (m_expression.uses(DerivedQuantityVariable_X) || m_expression.uses(DerivedQuantityVariable_Y) ||
+            m_expression.uses(DerivedQuantityVariable_Z))
+    {
+        coordinates.resize(3 * count);
+        double *x = coordinates.data();
+        double *y = x + count;
+        double *z = y + count;
+
+#pragma omp parallel for
+        for (int k = 0; k < solution->nz(); k++)
+            for (int j = 0; j < ny; j++)
+                for (int i = 0; i < nx; i++)
+                {
+                    int index = solution->index(i, j, k);
+                    Point3 point = solution->point(i, j, k);
+                    x[index] = point.x;
+                    y[index] = point.y;
+                    z[index] = point.z;
+                }
+
+        arguments[DerivedQuantityVariable_X] = x;
+        arguments[DerivedQuantityVariable_Y] = y;
+        arguments[DerivedQuantityVariable_Z] = z;
+    }
+
+    // field
+    QVector<double> field;
+    if (m_expression.uses(DerivedQuantityVariable_Ex) || m_expression.uses(DerivedQuantityVariable_Ey) ||
+            m_expression.uses(DerivedQuantityVariable_Ez) || m_expression.uses(DerivedQuantityVariable_E))
+    {
+        QVector<float> gradients;
+        solution->gradients(gradients);
+        const float *gradient = gradients.constData();
+
+        field.resize(4 * count);
+        double *ex = field.data();
+        double *ey = ex + count;
+        double *ez = ey + count;
+        double *e = ez + count;
+
+#pragma omp parallel for
+        for (int i = 0; i < count; i++)
+        {
+            ex[i] = - gradient[3*i];
+            ey[i] = - gradient[3*i + 1];
+            ez[i] = - gradient[3*i + 2];
+            e[i] = sqrt(ex[i]*ex[i] + ey[i]*ey[i] + ez[i]*ez[i]);
+        }
+
+        arguments[DerivedQuantityVariable_Ex] = ex;
+        arguments[DerivedQuantityVariable_Ey] = ey;
+        arguments[DerivedQuantityVariable_Ez] = ez;
+        arguments[DerivedQuantityVariable_E] = e;
+    }
+
+    m_grid = new SolutionGrid(solution->box(), nx, ny, solution->nz());
+    m_expression.evaluate(arguments, count, m_grid->values());
+    m_solutionRevision = solution->revision();
+
+    return m_grid;
+}
@@ -0,0 +1,58 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef DERIVEDQUANTITY_H
+#define DERIVEDQUANTITY_H
+
+#include "util.h"
+#include "parser/expression.h"
+
+class SolutionGrid;
+
+/// user-defined quantity given by an expression of the solution: x, y, z (coordinates), V (potential),
+/// Ex, Ey, Ez (field, minus gradient of the potential) and E (magnitude of the field)
+/// the expression is compiled once, values are computed for the whole grid at first use (display or export)
+/// and kept until the solution changes, only variables used by the expression are prepared
+class DerivedQuantity
+{
+public:
+    /// throws ParserException if the expression cannot be compiled
+    DerivedQuantity(const QString &name, const QString &expression);
+    ~DerivedQuantity();
+
+    static QStringList variables();
+
+    inline QString name() const { return m_name; }
+    inline QString expression() const { return m_expression.expression(); }
+
+    /// values in the points of the solution grid (same geometry), owned by the quantity
+    const SolutionGrid *grid(const SolutionGrid *solution);
+
+    /// forgets the computed values
+    void clear();
+
+private:
+    QString m_name;
+    Expression m_expression;
+
+    SolutionGrid *m_grid;
+    int m_solutionRevision;
+};
+
+#endif // DERIVEDQUANTITY_H
@@ -0,0 +1,201 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "fieldinterpolator.h"
+#include "solutiongrid.h"
+#include "solver.h"
+
+// interpolation error of the 1/r kernel in the distance d from the source,
+// relative to the kernel: linear ~ C (h/d)^2, cubic ~ C (h/d)^3 (calibrated including the stencil reach)
+static const double LINEARERRORCOEFFICIENT = 0.25;
+static const double CUBICERRORCOEFFICIENT = 0.5;
+
+// samples outside the grid (first or last interval) are extrapolated quadratically,
+// clamping them would drop the spline to first order along the boundary
+static inline double catmullRom(double p0, double p1, double p2, double p3, double t, bool first, bool last)
+{
+    if (first)
+        p0 = 3.0 * (p1 - p2) + p3;
+    if (last)
+        p3 = 3.0 * (p2 - p1) + p0;
+
+    return p1 + 0.5 * t * (p2 - p0 + t * (2.0*p0 - 5.0*p1 + 4.0*p2 - p3 + t * (3.0*(p1 - p2) + p3 - p0)));
+}
+
+FieldInterpolator::FieldInterpolator(const SolutionGrid *grid, QSharedPointer<Solver> solver,
+                                     FieldInterpolation interpolation, double tolerance)
+    : m_grid(grid), m_solver(solver), m_interpolation(interpolation), m_tolerance(tolerance), m_radius(0.0)
+{
+    // the cubic stencil needs four points per axis
+    if (qMin(m_grid->nx(), qMin(m_grid->ny(), m_grid->nz())) < 4)
+        m_interpolation = FieldInterpolation_Linear;
+
+    if (m_solver && m_solver->sourceCount() > 0)
+    {
+        Point3 step = m_grid->step();
+        double h = qMax(step.x, qMax(step.y, step.z));
+
+        if (m_interpolation == FieldInterpolation_Linear)
+            m_radius = h * sqrt(LINEARERRORCOEFFICIENT / m_tolerance);
+        else
+            m_radius = h * pow(CUBICERRORCOEFFICIENT / m_tolerance, 1.0 / 3.0);
+    }
+
+    flagCells();
+}
+
+bool FieldInterpolator::contains(const Point3 &point) const
+{
+    return m_grid->contains(point);
+}
+
+int FieldInterpolator::cellIndex(const Point3 &point) const
+{
+    CubePoint box = m_grid->box();
+    Point3 step = m_grid->step();
+
+    int i = qBound(0, (int) floor((point.x - box.start.x) / step.x), m_grid->nx() - 2);
+    int j = qBound(0, (int) floor((point.y - box.start.y) / step.y), m_grid->ny() - 2);
+    int k = qBound(0, (int) floor((point.z - box.start.z) / step.z), m_grid->nz() - 2);
+
+    return (k * (m_grid->ny() - 1) + j) * (m_grid->nx() - 1) + i;
+}
+
+void FieldInterpolator::flagCells()
+{
+    int cx = m_grid->nx() - 1;
+    int cy = m_grid->ny() - 1;
+    int cz = m_grid->nz() - 1;
+
+    m_direct = QBitArray(cx * cy * cz);
+    if (m_radius <= 0.0)
+        return;
+
+    // every point of a flagged cell can be closer than the radius to a source
+    Point3 step = m_grid->step();
+    CubePoint box = m_grid->box();
+    double reach = m_radius + 0.5 * step.magnitude();
+
+    // only the cells around each source are visited, sources are few compared to the cells
+    for (int s = 0; s < m_solver->sourceCount(); s++)
+    {
+        Point3 source = m_solver->source(s);
+
+        int i0 = qMax(0, (int) floor((source.x - reach - box.start.x) / step.x));
+        int i1 = qMin(cx - 1, (int) floor((source.x + reach - box.start.x) / step.x));
+        int j0 = qMax(0, (int) floor((source.y - reach - box.start.y) / step.y));
+        int j1 = qMin(cy - 1, (int) floor((source.y + reach - box.start.y) / step.y));
+        int k0 = qMax(0, (int) floor((source.z - reach - box.start.z) / step.z));
+        int k1 = qMin(cz - 1, (int) floor((source.z + reach - box.start.z) / step.z));
+
+        for (int k = k0; k <= k1; k++)
+            for (int j = j0; j <= j1; j++)
+                for (int i = i0; i <= i1; i++)
+                {
+                    Point3 center = m_grid->point(i, j, k) + step / 2.0;
+                    if ((center - source).magnitude() < reach)
+                        m_direct.setBit((k * cy + j) * cx + i);
+                }
+    }
+}
+
+bool FieldInterpolator::isDirect(const Point3 &point) const
+{
+    if (!m_solver)
+        return false;
+
+    // few sources are summed faster than the stencil is gathered
+    if (m_solver->sourceCount() <= FIELDINTERPOLATORDIRECTSOURCES)
+        return true;
+
+    return !m_grid->contains(point) || m_direct.testBit(cellIndex(point));
+}
+
+double FieldInterpolator::value(const Point3 &point) const
+{
+    if (isDirect(point))
+        return m_solver->value(point);
+
+    if (m_interpolation == FieldInterpolation_Linear)
+        return linear(point);
+    else
+        return cubic(point);
+}
+
+double FieldInterpolator::linear(const Point3 &point) const
+{
+    int indices[8];
+    double weights[8];
+    m_grid->stencil(point, indices, weights);
+
+    const double *values = m_grid->values();
+    double sum = 0.0;
+    for (int c = 0; c < 8; c++)
+        sum += weights[c] * values[indices[c]];
+
+    return sum;
+}
+
+double FieldInterpolator::cubic(const Point3 &point) const
+{
+    CubePoint box = m_grid->box();
+    Point3 step = m_grid->step();
+    int nx = m_grid->nx();
+    int ny = m_grid->ny();
+    int nz = m_grid->nz();
+
+    double u = qBound(0.0, (point.x - box.start.x) / step.x, nx - 1.0);
+    double v = qBound(0.0, (point.y - box.start.y) / step.y, ny - 1.0);
+    double w = qBound(0.0, (point.z - box.start.z) / step.z, nz - 1.0);
+
+    int i = qMin((int) u, nx - 2);
+    int j = qMin((int) v, ny - 2);
+    int k = qMin((int) w, nz - 2);
+    u -= i;
+    v -= j;
+    w -= k;
+
+    // stencil 4 x 4 x 4, indices clamped on the boundary of the grid (replaced by extrapolation)
+    bool fi = (i == 0), li = (i == nx - 2);
+    bool fj = (j == 0), lj = (j == ny - 2);
+    bool fk = (k == 0), lk = (k == nz - 2);
+
+    int ii[4], jj[4], kk[4];
+    for (int c = 0; c < 4; c++)
+    {
+        ii[c] = qBound(0, i - 1 + c, nx - 1);
+        jj[c] = qBound(0, j - 1 + c, ny - 1);
+        kk[c] = qBound(0, k - 1 + c, nz - 1);
+    }
+
+    const double *values = m_grid->values();
+    double planes[4];
+    for (int c = 0; c < 4; c++)
+    {
+        double rows[4];
+        for (int b = 0; b < 4; b++)
+        {
+            const double *row = values + m_grid->index(0, jj[b], kk[c]);
+            rows[b] = catmullRom(row[ii[0]], row[ii[1]], row[ii[2]], row[ii[3]], u, fi, li);
+        }
+        planes[c] = catmullRom(rows[0], rows[1], rows[2], rows[3], v, fj, lj);
+    }
+
+    return catmullRom(planes[0], planes[1], planes[2], planes[3], w, fk, lk);
+}
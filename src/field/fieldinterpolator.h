@@ -0,0 +1,81 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef FIELDINTERPOLATOR_H
+#define FIELDINTERPOLATOR_H
+
+#include "util.h"
+
+class SolutionGrid;
+class Solver;
+
+enum FieldInterpolation
+{
+    FieldInterpolation_Linear,
+    FieldInterpolation_Cubic
+};
+
+/// values of the solution in arbitrary points, O(1) per query
+/// the cell is found directly from the uniform grid, values are interpolated trilinearly or by tricubic
+/// Catmull-Rom splines; the potential of a point source is resolved by the grid only far enough from it,
+/// cells closer than radius() to any source are flagged and evaluated directly by the solver
+/// contract: outside the flagged cells the relative error of the interpolated potential is below tolerance()
+/// (estimated from the interpolation error of the 1/r kernel), inside them the value is exact;
+/// points outside the grid and scenes with few sources are evaluated directly
+class FieldInterpolator
+{
+public:
+    /// the interpolator shares the solver (it can outlive the solution in a background evaluation)
+    FieldInterpolator(const SolutionGrid *grid, QSharedPointer<Solver> solver = QSharedPointer<Solver>(),
+                      FieldInterpolation interpolation = FieldInterpolation_Cubic,
+                      double tolerance = FIELDINTERPOLATORTOLERANCE);
+
+    inline const SolutionGrid *grid() const { return m_grid; }
+    inline FieldInterpolation interpolation() const { return m_interpolation; }
+    inline double tolerance() const { return m_tolerance; }
+
+    /// distance from the sources below which the values are evaluated directly (0 without solver)
+    inline double radius() const { return m_radius; }
+
+    bool contains(const Point3 &point) const;
+    /// point lies in a cell evaluated directly or outside the grid (always false without solver)
+    bool isDirect(const Point3 &point) const;
+
+    /// value in the point, points outside the grid are evaluated directly
+    /// (clamped to the grid box without solver)
+    double value(const Point3 &point) const;
+
+private:
+    const SolutionGrid *m_grid;
+    QSharedPointer<Solver> m_solver;
+    FieldInterpolation m_interpolation;
+    double m_tolerance;
+    double m_radius;
+
+    // cells (nx - 1) x (ny - 1) x (nz - 1) near the sources
+    QBitArray m_direct;
+
+    int cellIndex(const Point3 &point) const;
+    void flagCells();
+
+    double linear(const Point3 &point) const;
+    double cubic(const Point3 &point) const;
+};
+
+#endif // FIELDINTERPOLATOR_H
@@ -0,0 +1,355 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "integralvalue.h"
+#include "fieldinterpolator.h"
+#include "solutiongrid.h"
+#include "problem.h"
+
+#include "scene.h"
+#include "scenenode.h"
+
+#include "util/constants.h"
+
+// step of the central differences relative to the step of the grid
+static const double GRADIENTSTEP = 1e-2;
+
+static inline Point3 crossProduct(const Point3 &a, const Point3 &b)
+{
+    return Point3(a.y*b.z - a.z*b.y, a.z*b.x - a.x*b.z, a.x*b.y - a.y*b.x);
+}
+
+QByteArray IntegralElement::key() const
+{
+    QByteArray result;
+    for (int i = 0; i < count; i++)
+    {
+        result.append((const char *) &points[i].x, sizeof(double));
+        result.append((const char *) &points[i].y, sizeof(double));
+        result.append((const char *) &points[i].z, sizeof(double));
+    }
+
+    return result;
+}
+
+IntegralValue::IntegralValue(int dimension) : m_dimension(dimension), m_revision(0)
+{
+}
+
+QList<IntegralElement> IntegralValue::elements(const QList<Point3> &nodes, int dimension)
+{
+    QList<IntegralElement> result;
+
+    if (dimension == 1)
+    {
+        for (int i = 0; i + 1 < nodes.count(); i++)
+        {
+            IntegralElement element;
+            element.count = 2;
+            element.points[0] = nodes[i];
+            element.points[1] = nodes[i + 1];
+            result.append(element);
+        }
+    }
+    else
+    {
+        for (int i = 1; i + dimension - 1 < nodes.count(); i++)
+        {
+            IntegralElement element;
+            element.count = dimension + 1;
+            element.points[0] = nodes[0];
+            for (int j = 0; j < dimension; j++)
+                element.points[j + 1] = nodes[i + j];
+            result.append(element);
+        }
+    }
+
+    return result;
+}
+
+void IntegralValue::clear()
+{
+    m_revision = 0;
+    m_elements.clear();
+    m_contributions.clear();
+    m_values.clear();
+}
+
+void IntegralValue::update()
+{
+    QSharedPointer<FieldInterpolator> interpolator = Util::problem()->interpolator();
+    if (interpolator.isNull())
+    {
+        clear();
+        return;
+    }
+
+    QList<Point3> nodes;
+    foreach (SceneNode *node, Util::scene()->nodes->items())
+        if (node->isSelected())
+            nodes.append(node->point());
+
+    update(interpolator.data(), interpolator->grid()->revision(), elements(nodes, m_dimension));
+}
+
+void IntegralValue::update(const FieldInterpolator *interpolator, int revision, const QList<IntegralElement> &elements)
+{
+    int quantities = names().count();
+
+    // contributions belong to the solution
+    if (revision != m_revision)
+    {
+        m_elements.clear();
+        m_contributions.clear();
+        m_values.fill(0.0, quantities);
+        m_revision = revision;
+    }
+    if (m_values.count() != quantities)
+        m_values.fill(0.0, quantities);
+
+    QList<QByteArray> keys;
+    QSet<QByteArray> selected;
+    foreach (IntegralElement element, elements)
+    {
+        QByteArray key = element.key();
+        if (!selected.contains(key))
+        {
+            selected.insert(key);
+            keys.append(key);
+        }
+    }
+
+    // removed elements (their contributions stay cached)
+    foreach (QByteArray key, m_elements)
+        if (!selected.contains(key))
+        {
+            const QVector<double> &contribution = m_contributions[key];
+            for (int q = 0; q < quantities; q++)
+                m_values[q] -= contribution[q];
+        }
+
+    // added elements
+    QSet<QByteArray> integrated = QSet<QByteArray>::fromList(m_elements);
+    Point3 step = interpolator->grid()->step();
+    double h = qMax(step.x, qMax(step.y, step.z));
+
+    for (int i = 0; i < elements.count(); i++)
+    {
+        QByteArray key = elements[i].key();
+        if (integrated.contains(key))
+            continue;
+        integrated.insert(key);
+
+        if (!m_contributions.contains(key))
+        {
+            QVector<double> contribution(quantities, 0.0);
+            integrate(interpolator, h, elements[i], contribution.data());
+            m_contributions.insert(key, contribution);
+        }
+
+        const QVector<double> &contribution = m_contributions[key];
+        for (int q = 0; q < quantities; q++)
+            m_values[q] += contribution[q];
+    }
+
+    m_elements = keys;
+
+    // no rounding residue of the subtractions
+    if (m_elements.isEmpty())
+        m_values.fill(0.0, quantities);
+
+#ifndef QT_NO_DEBUG
+    // running totals are equal to the values of a fresh calculator (sum over the selected elements)
+    for (int q = 0; q < quantities; q++)
+    {
+        double sum = 0.0;
+        double magnitude = 0.0;
+        foreach (QByteArray key, m_elements)
+        {
+            sum += m_contributions[key][q];
+            magnitude += fabs(m_contributions[key][q]);
+        }
+        Q_ASSERT(fabs(m_values[q] - sum) <= INTEGRALCHECKTOLERANCE * (magnitude + fabs(m_values[q])) + EPS_ZERO);
+    }
+#endif
+}
+
+int IntegralValue::subdivision(double length, double step)
+{
+    return qBound(1, (int) ceil(length / step), INTEGRALMAXIMUMSUBDIVISION);
+}
+
+void IntegralValue::gauss(int subdivision, QVector<double> &points, QVector<double> &weights)
+{
+    const double offset = 0.5 / sqrt(3.0);
+
+    points.resize(2 * subdivision);
+    weights.resize(2 * subdivision);
+    for (int i = 0; i < subdivision; i++)
+    {
+        double center = (i + 0.5) / subdivision;
+        points[2*i] = center - offset / subdivision;
+        points[2*i + 1] = center + offset / subdivision;
+        weights[2*i] = 0.5 / subdivision;
+        weights[2*i + 1] = 0.5 / subdivision;
+    }
+}
+
+// *************************************************************************************************************************************
+
+QStringList LineIntegralValue::names() const
+{
+    return QStringList() << QObject::tr("Length") << QObject::tr("Potential") << QObject::tr("Voltage");
+}
+
+void LineIntegralValue::integrate(const FieldInterpolator *interpolator, double step,
+                                  const IntegralElement &element, double *result) const
+{
+    Point3 a = element.points[0];
+    Point3 direction = element.points[1] - a;
+    double length = direction.magnitude();
+
+    QVector<double> points;
+    QVector<double> weights;
+    gauss(subdivision(length, step), points, weights);
+
+    const double *t = points.constData();
+    const double *w = weights.constData();
+    int count = points.count();
+
+    double potential = 0.0;
+#pragma omp parallel for reduction(+:potential)
+    for (int i = 0; i < count; i++)
+        potential += w[i] * interpolator->value(a + direction * t[i]);
+
+    result[0] += length;
+    result[1] += potential * length;
+    // integral of the field along the line
+    result[2] += interpolator->value(a) - interpolator->value(element.points[1]);
+}
+
+// *************************************************************************************************************************************
+
+QStringList SurfaceIntegralValue::names() const
+{
+    return QStringList() << QObject::tr("Area") << QObject::tr("Potential") << QObject::tr("Flux");
+}
+
+void SurfaceIntegralValue::integrate(const FieldInterpolator *interpolator, double step,
+                                     const IntegralElement &element, double *result) const
+{
+    Point3 a = element.points[0];
+    Point3 ab = element.points[1] - a;
+    Point3 ac = element.points[2] - a;
+
+    Point3 normal = crossProduct(ab, ac);
+    double area = normal.magnitude() / 2.0;
+    if (area < EPS_ZERO)
+        return;
+    normal = normal / (2.0 * area);
+
+    double length = qMax(ab.magnitude(), qMax(ac.magnitude(), (ac - ab).magnitude()));
+
+    QVector<double> points;
+    QVector<double> weights;
+    gauss(subdivision(length, step), points, weights);
+
+    const double *t = points.constData();
+    const double *w = weights.constData();
+    int count = points.count();
+    double delta = GRADIENTSTEP * step;
+
+    // collapsed square (u, v) -> (u, v (1 - u)) covers the triangle
+    double potential = 0.0;
+    double flux = 0.0;
+#pragma omp parallel for reduction(+:potential,flux)
+    for (int n = 0; n < count * count; n++)
+    {
+        double u = t[n / count];
+        double v = t[n % count] * (1.0 - u);
+        double weight = w[n / count] * w[n % count] * (1.0 - u);
+
+        Point3 point = a + ab * u + ac * v;
+        potential += weight * interpolator->value(point);
+        flux += weight * (interpolator->value(point - normal * delta) - interpolator->value(point + normal * delta)) / (2.0 * delta);
+    }
+
+    result[0] += area;
+    result[1] += 2.0 * area * potential;
+    result[2] += 2.0 * area * flux;
+}
+
+// *************************************************************************************************************************************
+
+QStringList VolumeIntegralValue::names() const
+{
+    return QStringList() << QObject::tr("Volume") << QObject::tr("Potential") << QObject::tr("Energy");
+}
+
+void VolumeIntegralValue::integrate(const FieldInterpolator *interpolator, double step,
+                                    const IntegralElement &element, double *result) const
+{
+    Point3 a = element.points[0];
+    Point3 ab = element.points[1] - a;
+    Point3 ac = element.points[2] - a;
+    Point3 ad = element.points[3] - a;
+
+    double volume = fabs(crossProduct(ab, ac) & ad) / 6.0;
+    if (volume < EPS_ZERO)
+        return;
+
+    double length = qMax(qMax(ab.magnitude(), ac.magnitude()), ad.magnitude());
+
+    QVector<double> points;
+    QVector<double> weights;
+    gauss(subdivision(length, step), points, weights);
+
+    const double *t = points.constData();
+    const double *w = weights.constData();
+    int count = points.count();
+    double delta = GRADIENTSTEP * step;
+
+    // collapsed cube (u, v, w) -> (u, v (1 - u), w (1 - u) (1 - v)) covers the tetrahedron
+    double potential = 0.0;
+    double energy = 0.0;
+#pragma omp parallel for reduction(+:potential,energy)
+    for (int n = 0; n < count * count * count; n++)
+    {
+        int i = n / (count * count);
+        int j = (n / count) % count;
+        int k = n % count;
+
+        double u = t[i];
+        double v = t[j] * (1.0 - u);
+        double s = t[k] * (1.0 - u) * (1.0 - t[j]);
+        double weight = w[i] * w[j] * w[k] * (1.0 - u) * (1.0 - u) * (1.0 - t[j]);
+
+        Point3 point = a + ab * u + ac * v + ad * s;
+        double ex = (interpolator->value(point + Point3(delta, 0, 0)) - interpolator->value(point - Point3(delta, 0, 0))) / (2.0 * delta);
+        double ey = (interpolator->value(point + Point3(0, delta, 0)) - interpolator->value(point - Point3(0, delta, 0))) / (2.0 * delta);
+        double ez = (interpolator->value(point + Point3(0, 0, delta)) - interpolator->value(point - Point3(0, 0, delta))) / (2.0 * delta);
+
+        potential += weight * interpolator->value(point);
+        energy += weight * 0.5 * (ex*ex + ey*ey + ez*ez);
+    }
+
+    result[0] += volume;
+    result[1] += 6.0 * volume * potential;
+    result[2] += 6.0 * volume * energy;
+}
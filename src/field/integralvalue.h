@@ -0,0 +1,128 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef INTEGRALVALUE_H
+#define INTEGRALVALUE_H
+
+#include "util.h"
+
+class FieldInterpolator;
+
+/// segment (2 points), triangle (3 points) or tetrahedron (4 points) spanned by nodes
+struct IntegralElement
+{
+    Point3 points[4];
+    int count;
+
+    IntegralElement() : count(0) {}
+
+    /// identifies the element in the cache of contributions
+    QByteArray key() const;
+};
+
+/// integral quantities over elements spanned by the selected nodes
+/// contributions of the elements are cached, changing the selection integrates only the added elements
+/// and subtracts the removed ones; the cache is dropped when the solution changes
+/// every element is integrated by composite Gauss quadrature (step of the solution grid) evaluated in parallel
+class IntegralValue
+{
+public:
+    IntegralValue(int dimension);
+    virtual ~IntegralValue() {}
+
+    /// 1 - line, 2 - surface, 3 - volume
+    inline int dimension() const { return m_dimension; }
+
+    /// elements of the nodes in their order: polyline of segments, fan of triangles or strip of tetrahedra
+    /// around the first node
+    static QList<IntegralElement> elements(const QList<Point3> &nodes, int dimension);
+
+    /// integrates the elements (only those not integrated yet for the solution)
+    void update(const FieldInterpolator *interpolator, int revision, const QList<IntegralElement> &elements);
+    /// elements of the selected nodes of the scene, solution of the problem
+    void update();
+
+    void clear();
+
+    /// number of elements integrated
+    inline int count() const { return m_elements.count(); }
+
+    virtual QStringList names() const = 0;
+    inline QVector<double> values() const { return m_values; }
+
+protected:
+    /// adds the integrals over the element to result (names().count() values)
+    virtual void integrate(const FieldInterpolator *interpolator, double step,
+                           const IntegralElement &element, double *result) const = 0;
+
+    /// number of Gauss intervals along an edge of the given length
+    static int subdivision(double length, double step);
+
+    /// composite two point Gauss rule on (0, 1)
+    static void gauss(int subdivision, QVector<double> &points, QVector<double> &weights);
+
+private:
+    int m_dimension;
+    int m_revision;
+
+    QList<QByteArray> m_elements;
+    QHash<QByteArray, QVector<double> > m_contributions;
+    QVector<double> m_values;
+};
+
+/// length, integral of the potential and voltage between the endpoints
+class LineIntegralValue : public IntegralValue
+{
+public:
+    LineIntegralValue() : IntegralValue(1) {}
+
+    QStringList names() const;
+
+protected:
+    void integrate(const FieldInterpolator *interpolator, double step,
+                   const IntegralElement &element, double *result) const;
+};
+
+/// area, integral of the potential and flux of the field (normal given by the order of the nodes)
+class SurfaceIntegralValue : public IntegralValue
+{
+public:
+    SurfaceIntegralValue() : IntegralValue(2) {}
+
+    QStringList names() const;
+
+protected:
+    void integrate(const FieldInterpolator *interpolator, double step,
+                   const IntegralElement &element, double *result) const;
+};
+
+/// volume, integral of the potential and energy of the field
+class VolumeIntegralValue : public IntegralValue
+{
+public:
+    VolumeIntegralValue() : IntegralValue(3) {}
+
+    QStringList names() const;
+
+protected:
+    void integrate(const FieldInterpolator *interpolator, double step,
+                   const IntegralElement &element, double *result) const;
+};
+
+#endif // INTEGRALVALUE_H
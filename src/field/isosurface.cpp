@@ -0,0 +1,371 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "isosurface.h"
+#include "isosurface_data.h"
+#include "solutiongrid.h"
+
+// number of cells along block edge
+const int BLOCK_SIZE = 16;
+
+// triangles of one block, vertices are indexed locally
+struct IsoSurfaceBlockMesh
+{
+    QVector<float> vertices;
+    QVector<float> normals;
+    QVector<unsigned int> indices;
+    // edge key of vertices lying on the block faces (shared with neighbouring blocks), -1 for inner vertices
+    QVector<qint64> boundaryKeys;
+
+    // local index -> index in the merged mesh
+    QVector<unsigned int> map;
+    unsigned int firstVertex;
+};
+
+static void extractBlock(const SolutionGrid *grid, const float *gradients,
+                         const IsoSurfaceBlock &block, double isoValue,
+                         IsoSurfaceBlockMesh &mesh)
+{
+    const double *values = grid->values();
+
+    // edges are identified by the lower point and axis, so that neighbouring cells find the same vertex
+    QHash<qint64, unsigned int> vertexMap;
+
+    for (int k = block.k0; k < block.k1; k++)
+    {
+        for (int j = block.j0; j < block.j1; j++)
+        {
+            for (int i = block.i0; i < block.i1; i++)
+            {
+                int cornerIndex[8];
+                int cubeIndex = 0;
+                for (int c = 0; c < 8; c++)
+                {
+                    cornerIndex[c] = grid->index(i + mcCorner[c][0], j + mcCorner[c][1], k + mcCorner[c][2]);
+                    if (values[cornerIndex[c]] < isoValue)
+                        cubeIndex |= (1 << c);
+                }
+
+                int edges = mcEdgeTable[cubeIndex];
+                if (edges == 0)
+                    continue;
+
+                unsigned int edgeVertex[12];
+                for (int e = 0; e < 12; e++)
+                {
+                    if (!(edges & (1 << e)))
+                        continue;
+
+                    // lower and upper corner of the edge
+                    int c0 = mcEdge[e][0];
+                    int c1 = mcEdge[e][1];
+                    if (cornerIndex[c1] < cornerIndex[c0])
+                        qSwap(c0, c1);
+
+                    int axis = (mcCorner[c0][0] != mcCorner[c1][0]) ? 0 : ((mcCorner[c0][1] != mcCorner[c1][1]) ? 1 : 2);
+                    qint64 key = 3 * (qint64) cornerIndex[c0] + axis;
+
+                    QHash<qint64, unsigned int>::const_iterator it = vertexMap.constFind(key);
+                    if (it != vertexMap.constEnd())
+                    {
+                        edgeVertex[e] = it.value();
+                        continue;
+                    }
+
+                    // interpolation always goes from the lower corner, position is identical in all blocks
+                    double v0 = values[cornerIndex[c0]];
+                    double v1 = values[cornerIndex[c1]];
+                    double t = (isoValue - v0) / (v1 - v0);
+
+                    int pi = i + mcCorner[c0][0];
+                    int pj = j + mcCorner[c0][1];
+                    int pk = k + mcCorner[c0][2];
+
+                    Point3 point = grid->point(pi, pj, pk);
+                    Point3 step = grid->step();
+                    if (axis == 0) point.x += t * step.x;
+                    if (axis == 1) point.y += t * step.y;
+                    if (axis == 2) point.z += t * step.z;
+
+                    mesh.vertices.append(point.x);
+                    mesh.vertices.append(point.y);
+                    mesh.vertices.append(point.z);
+
+                    // normal from cached point gradients
+                    const float *g0 = gradients + 3 * cornerIndex[c0];
+                    const float *g1 = gradients + 3 * cornerIndex[c1];
+                    double nx = g0[0] + t * (g1[0] - g0[0]);
+                    double ny = g0[1] + t * (g1[1] - g0[1]);
+                    double nz = g0[2] + t * (g1[2] - g0[2]);
+                    double length = sqrt(nx*nx + ny*ny + nz*nz);
+                    if (length > EPS_ZERO)
+                    {
+                        nx /= length;
+                        ny /= length;
+                        nz /= length;
+                    }
+
+                    mesh.normals.append(nx);
+                    mesh.normals.append(ny);
+                    mesh.normals.append(nz);
+
+                    // edge lies on the block face when any of the other coordinates is on the block boundary
+                    bool boundary = (axis != 0 && (pi == block.i0 || pi == block.i1))
+                            || (axis != 1 && (pj == block.j0 || pj == block.j1))
+                            || (axis != 2 && (pk == block.k0 || pk == block.k1));
+                    mesh.boundaryKeys.append(boundary ? key : -1);
+
+                    unsigned int vertex = mesh.boundaryKeys.size() - 1;
+                    vertexMap.insert(key, vertex);
+                    edgeVertex[e] = vertex;
+                }
+
+                for (int t = 0; mcTriTable[cubeIndex][t] != -1; t += 3)
+                {
+                    mesh.indices.append(edgeVertex[mcTriTable[cubeIndex][t]]);
+                    mesh.indices.append(edgeVertex[mcTriTable[cubeIndex][t + 1]]);
+                    mesh.indices.append(edgeVertex[mcTriTable[cubeIndex][t + 2]]);
+                }
+            }
+        }
+    }
+}
+
+IsoSurface::IsoSurface() : m_grid(NULL), m_gridRevision(-1), m_min(0.0), m_max(0.0)
+{
+}
+
+void IsoSurface::setGrid(const SolutionGrid *grid)
+{
+    if (m_grid == grid && (!grid || m_gridRevision == grid->revision()))
+        return;
+
+    m_grid = grid;
+    m_gridRevision = grid ? grid->revision() : -1;
+
+    // surfaces of the old grid are not valid anymore
+    m_meshes.clear();
+
+    prepare();
+}
+
+void IsoSurface::setIsoValues(const QList<double> &isoValues)
+{
+    m_isoValues = isoValues;
+}
+
+void IsoSurface::update()
+{
+    QList<IsoSurfaceMeshPointer> meshes;
+
+    if (m_grid)
+    {
+        foreach (double isoValue, m_isoValues)
+        {
+            IsoSurfaceMeshPointer mesh;
+            foreach (IsoSurfaceMeshPointer computed, m_meshes)
+            {
+                if (computed->isoValue == isoValue)
+                {
+                    mesh = computed;
+                    break;
+                }
+            }
+
+            if (mesh.isNull())
+                mesh = extract(isoValue);
+
+            meshes.append(mesh);
+        }
+    }
+
+    m_meshes = meshes;
+}
+
+void IsoSurface::clear()
+{
+    m_grid = NULL;
+    m_gridRevision = -1;
+
+    m_meshes.clear();
+    m_isoValues.clear();
+
+    prepare();
+}
+
+void IsoSurface::prepare()
+{
+    m_blocks.clear();
+    m_gradients.clear();
+    m_min = 0.0;
+    m_max = 0.0;
+
+    if (!m_grid)
+        return;
+
+    int nx = m_grid->nx();
+    int ny = m_grid->ny();
+    int nz = m_grid->nz();
+    const double *values = m_grid->values();
+
+    for (int k0 = 0; k0 < nz - 1; k0 += BLOCK_SIZE)
+    {
+        for (int j0 = 0; j0 < ny - 1; j0 += BLOCK_SIZE)
+        {
+            for (int i0 = 0; i0 < nx - 1; i0 += BLOCK_SIZE)
+            {
+                IsoSurfaceBlock block;
+                block.i0 = i0;
+                block.j0 = j0;
+                block.k0 = k0;
+                block.i1 = qMin(i0 + BLOCK_SIZE, nx - 1);
+                block.j1 = qMin(j0 + BLOCK_SIZE, ny - 1);
+                block.k1 = qMin(k0 + BLOCK_SIZE, nz - 1);
+
+                m_blocks.append(block);
+            }
+        }
+    }
+
+    // value range of blocks (including the points on the upper faces)
+    IsoSurfaceBlock *blocks = m_blocks.data();
+#pragma omp parallel for schedule(dynamic)
+    for (int b = 0; b < m_blocks.size(); b++)
+    {
+        IsoSurfaceBlock &block = blocks[b];
+        block.min = numeric_limits<double>::max();
+        block.max = -numeric_limits<double>::max();
+
+        for (int k = block.k0; k <= block.k1; k++)
+        {
+            for (int j = block.j0; j <= block.j1; j++)
+            {
+                const double *row = values + m_grid->index(0, j, k);
+                for (int i = block.i0; i <= block.i1; i++)
+                {
+                    if (row[i] < block.min) block.min = row[i];
+                    if (row[i] > block.max) block.max = row[i];
+                }
+            }
+        }
+    }
+
+    m_min = numeric_limits<double>::max();
+    m_max = -numeric_limits<double>::max();
+    for (int b = 0; b < m_blocks.size(); b++)
+    {
+        m_min = qMin(m_min, m_blocks[b].min);
+        m_max = qMax(m_max, m_blocks[b].max);
+    }
+
+    // point gradients
+    m_grid->gradients(m_gradients);
+}
+
+IsoSurfaceMeshPointer IsoSurface::extract(double isoValue) const
+{
+    IsoSurfaceMeshPointer mesh(new IsoSurfaceMesh(isoValue));
+
+    // only blocks crossed by the isovalue
+    QVector<int> active;
+    for (int b = 0; b < m_blocks.size(); b++)
+        if (m_blocks[b].min < isoValue && m_blocks[b].max >= isoValue)
+            active.append(b);
+
+    if (active.isEmpty())
+        return mesh;
+
+    QVector<IsoSurfaceBlockMesh> blockMeshes(active.size());
+    IsoSurfaceBlockMesh *parts = blockMeshes.data();
+    const IsoSurfaceBlock *blocks = m_blocks.constData();
+    const int *activeBlocks = active.constData();
+    const float *gradients = m_gradients.constData();
+
+#pragma omp parallel for schedule(dynamic)
+    for (int a = 0; a < active.size(); a++)
+        extractBlock(m_grid, gradients, blocks[activeBlocks[a]], isoValue, parts[a]);
+
+    // merge vertices on the block faces
+    QHash<qint64, unsigned int> boundaryVertices;
+    QVector<int> indexOffset(active.size());
+    unsigned int vertexCount = 0;
+    int indexCount = 0;
+
+    for (int a = 0; a < active.size(); a++)
+    {
+        IsoSurfaceBlockMesh &part = parts[a];
+
+        part.firstVertex = vertexCount;
+        part.map.resize(part.boundaryKeys.size());
+        for (int v = 0; v < part.boundaryKeys.size(); v++)
+        {
+            qint64 key = part.boundaryKeys[v];
+            if (key != -1)
+            {
+                QHash<qint64, unsigned int>::const_iterator it = boundaryVertices.constFind(key);
+                if (it != boundaryVertices.constEnd())
+                {
+                    part.map[v] = it.value();
+                    continue;
+                }
+
+                boundaryVertices.insert(key, vertexCount);
+            }
+
+            part.map[v] = vertexCount++;
+        }
+
+        indexOffset[a] = indexCount;
+        indexCount += part.indices.size();
+    }
+
+    mesh->vertices.resize(3 * vertexCount);
+    mesh->normals.resize(3 * vertexCount);
+    mesh->indices.resize(indexCount);
+
+    float *vertices = mesh->vertices.data();
+    float *normals = mesh->normals.data();
+    unsigned int *indices = mesh->indices.data();
+    const int *offsets = indexOffset.constData();
+
+#pragma omp parallel for schedule(dynamic)
+    for (int a = 0; a < active.size(); a++)
+    {
+        const IsoSurfaceBlockMesh &part = parts[a];
+
+        // new vertices are numbered from firstVertex, merged ones point to the previous blocks
+        for (int v = 0; v < part.map.size(); v++)
+        {
+            unsigned int vertex = part.map[v];
+            if (vertex < part.firstVertex)
+                continue;
+
+            for (int c = 0; c < 3; c++)
+            {
+                vertices[3 * vertex + c] = part.vertices[3 * v + c];
+                normals[3 * vertex + c] = part.normals[3 * v + c];
+            }
+        }
+
+        for (int t = 0; t < part.indices.size(); t++)
+            indices[offsets[a] + t] = part.map[part.indices[t]];
+    }
+
+    return mesh;
+}
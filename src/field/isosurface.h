@@ -0,0 +1,90 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef ISOSURFACE_H
+#define ISOSURFACE_H
+
+#include "util.h"
+
+class SolutionGrid;
+
+/// triangle mesh of one isosurface
+/// vertices are shared by adjacent triangles, arrays are laid out for glDrawElements
+struct IsoSurfaceMesh
+{
+    IsoSurfaceMesh(double isoValue) : isoValue(isoValue) {}
+
+    double isoValue;
+
+    QVector<float> vertices; // x, y, z
+    QVector<float> normals; // nx, ny, nz
+    QVector<unsigned int> indices; // three vertices per triangle
+
+    inline int vertexCount() const { return vertices.size() / 3; }
+    inline int triangleCount() const { return indices.size() / 3; }
+};
+
+typedef QSharedPointer<IsoSurfaceMesh> IsoSurfaceMeshPointer;
+
+/// cells [i0, i1) x [j0, j1) x [k0, k1) of the grid and range of values in their corners
+struct IsoSurfaceBlock
+{
+    int i0, j0, k0;
+    int i1, j1, k1;
+    double min, max;
+};
+
+/// marching cubes over the solution grid
+/// the grid is split into blocks of BLOCK_SIZE^3 cells processed in parallel, value range of every block
+/// and point gradients are cached, so change of isovalues visits only blocks crossed by the new isovalue
+class IsoSurface
+{
+public:
+    IsoSurface();
+
+    void setGrid(const SolutionGrid *grid);
+    void setIsoValues(const QList<double> &isoValues);
+
+    /// extracts surfaces of isovalues which are not computed yet
+    void update();
+    void clear();
+
+    inline QList<IsoSurfaceMeshPointer> meshes() const { return m_meshes; }
+
+    /// range of the grid values
+    inline double min() const { return m_min; }
+    inline double max() const { return m_max; }
+
+private:
+    const SolutionGrid *m_grid;
+    int m_gridRevision;
+
+    QVector<IsoSurfaceBlock> m_blocks;
+    QVector<float> m_gradients;
+    double m_min;
+    double m_max;
+
+    QList<double> m_isoValues;
+    QList<IsoSurfaceMeshPointer> m_meshes;
+
+    void prepare();
+    IsoSurfaceMeshPointer extract(double isoValue) const;
+};
+
+#endif // ISOSURFACE_H
@@ -0,0 +1,169 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "linesampler.h"
+#include "solutiongrid.h"
+
+double SolutionGridLineFunction::value(const Point3 &point) const
+{
+    if (m_grid && m_grid->contains(point))
+        return m_grid->interpolate(point);
+
+    return 0.0;
+}
+
+// **************************************************************************************************
+
+LineSampler::LineSampler(const Point3 &start, const Point3 &end)
+    : m_start(start), m_end(end),
+      m_initialPoints(CHARTINITIALPOINTS), m_maximumPoints(CHARTMAXIMUMPOINTS),
+      m_maximumLevels(CHARTMAXIMUMLEVELS), m_tolerance(CHARTTOLERANCE),
+      m_evaluations(0)
+{
+}
+
+void LineSampler::clear()
+{
+    m_parameters.clear();
+    m_values.clear();
+    m_evaluations = 0;
+}
+
+void LineSampler::evaluate(const LineSamplerFunction *function, const double *parameters, double *values, int count) const
+{
+    Point3 direction = m_end - m_start;
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int i = 0; i < count; i++)
+        values[i] = function->value(m_start + direction * parameters[i]);
+}
+
+void LineSampler::sample(const LineSamplerFunction *function)
+{
+    clear();
+    if (!function)
+        return;
+
+    // initial uniform points
+    int n = qMin(m_initialPoints, qMax(2, m_maximumPoints));
+    m_parameters.resize(n);
+    m_values.resize(n);
+    for (int i = 0; i < n; i++)
+        m_parameters[i] = (double) i / (n - 1);
+    m_parameters[n - 1] = 1.0;
+
+    evaluate(function, m_parameters.constData(), m_values.data(), n);
+    m_evaluations = n;
+
+    // intervals to bisect (indices of their left points, ascending)
+    QVector<int> candidates(n - 1);
+    for (int i = 0; i < n - 1; i++)
+        candidates[i] = i;
+
+    for (int level = 0; level < m_maximumLevels && !candidates.isEmpty(); level++)
+    {
+        int budget = m_maximumPoints - m_parameters.size();
+        if (budget <= 0)
+            break;
+
+        // not enough points for all intervals, the largest changes first
+        if (candidates.size() > budget)
+        {
+            QVector<QPair<double, int> > order;
+            order.reserve(candidates.size());
+            foreach (int candidate, candidates)
+                order.append(qMakePair(fabs(m_values[candidate + 1] - m_values[candidate]), candidate));
+            qSort(order.begin(), order.end(), qGreater<QPair<double, int> >());
+
+            candidates.resize(budget);
+            for (int i = 0; i < budget; i++)
+                candidates[i] = order[i].second;
+            qSort(candidates.begin(), candidates.end());
+        }
+
+        // midpoints of the level as one batch
+        int m = candidates.size();
+        QVector<double> midParameters(m);
+        QVector<double> midValues(m);
+        for (int c = 0; c < m; c++)
+            midParameters[c] = 0.5 * (m_parameters[candidates[c]] + m_parameters[candidates[c] + 1]);
+
+        evaluate(function, midParameters.constData(), midValues.data(), m);
+        m_evaluations += m;
+
+        // range of values
+        double min = m_values[0];
+        double max = m_values[0];
+        for (int i = 1; i < m_values.size(); i++)
+        {
+            min = qMin(min, m_values[i]);
+            max = qMax(max, m_values[i]);
+        }
+        for (int c = 0; c < m; c++)
+        {
+            min = qMin(min, midValues[c]);
+            max = qMax(max, midValues[c]);
+        }
+        double threshold = m_tolerance * (max - min);
+
+        // merge midpoints in, halves of the intervals with large error are refined further
+        QVector<double> parameters;
+        QVector<double> values;
+        parameters.reserve(m_parameters.size() + m);
+        values.reserve(m_parameters.size() + m);
+
+        QVector<int> next;
+        int c = 0;
+        for (int i = 0; i < m_parameters.size(); i++)
+        {
+            parameters.append(m_parameters[i]);
+            values.append(m_values[i]);
+
+            if (c < m && candidates[c] == i)
+            {
+                double error = fabs(midValues[c] - 0.5 * (m_values[i] + m_values[i + 1]));
+
+                parameters.append(midParameters[c]);
+                values.append(midValues[c]);
+
+                if (error > threshold)
+                {
+                    next.append(parameters.size() - 2);
+                    next.append(parameters.size() - 1);
+                }
+
+                c++;
+            }
+        }
+
+        m_parameters = parameters;
+        m_values = values;
+        candidates = next;
+    }
+}
+
+QList<Point3> LineSampler::points() const
+{
+    QList<Point3> result;
+    result.reserve(m_parameters.size());
+    for (int i = 0; i < m_parameters.size(); i++)
+        result.append(point(i));
+
+    return result;
+}
@@ -0,0 +1,105 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef LINESAMPLER_H
+#define LINESAMPLER_H
+
+#include "util.h"
+
+class SolutionGrid;
+
+/// quantity sampled along the line, value() is called in parallel and has to be thread safe
+class LineSamplerFunction
+{
+public:
+    virtual ~LineSamplerFunction() {}
+
+    virtual double value(const Point3 &point) const = 0;
+};
+
+/// interpolated solution, zero outside the grid
+class SolutionGridLineFunction : public LineSamplerFunction
+{
+public:
+    SolutionGridLineFunction(const SolutionGrid *grid) : m_grid(grid) {}
+
+    double value(const Point3 &point) const;
+
+private:
+    const SolutionGrid *m_grid;
+};
+
+/// adaptive sampling of the line segment start - end
+/// starts from uniformly distributed points and bisects the intervals where the midpoint differs from
+/// the linear interpolation of the interval end points by more than tolerance * (range of values),
+/// intervals are refined until the error is small or the maximum level or number of points is reached,
+/// all midpoints of one level are evaluated as one parallel batch
+class LineSampler
+{
+public:
+    LineSampler(const Point3 &start, const Point3 &end);
+
+    inline Point3 start() const { return m_start; }
+    inline Point3 end() const { return m_end; }
+
+    inline int initialPoints() const { return m_initialPoints; }
+    inline void setInitialPoints(int points) { m_initialPoints = qMax(2, points); }
+
+    inline int maximumPoints() const { return m_maximumPoints; }
+    inline void setMaximumPoints(int points) { m_maximumPoints = points; }
+
+    inline int maximumLevels() const { return m_maximumLevels; }
+    inline void setMaximumLevels(int levels) { m_maximumLevels = levels; }
+
+    inline double tolerance() const { return m_tolerance; }
+    inline void setTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    /// samples the function, previous samples are replaced
+    void sample(const LineSamplerFunction *function);
+    void clear();
+
+    inline int count() const { return m_parameters.size(); }
+    /// position on the line, 0 in the start, 1 in the end (increasing)
+    inline const QVector<double> &parameters() const { return m_parameters; }
+    inline const QVector<double> &values() const { return m_values; }
+
+    inline Point3 point(int i) const { return m_start + (m_end - m_start) * m_parameters[i]; }
+    inline double length(int i) const { return (m_end - m_start).magnitude() * m_parameters[i]; }
+    QList<Point3> points() const;
+
+    /// number of function evaluations of the last sampling
+    inline int evaluations() const { return m_evaluations; }
+
+private:
+    Point3 m_start;
+    Point3 m_end;
+
+    int m_initialPoints;
+    int m_maximumPoints;
+    int m_maximumLevels;
+    double m_tolerance;
+
+    QVector<double> m_parameters;
+    QVector<double> m_values;
+    int m_evaluations;
+
+    void evaluate(const LineSamplerFunction *function, const double *parameters, double *values, int count) const;
+};
+
+#endif // LINESAMPLER_H
@@ -0,0 +1,166 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "localvalueprobe.h"
+#include "problem.h"
+#include "solutiongrid.h"
+#include "fieldinterpolator.h"
+
+#include "util/constants.h"
+
+LocalValueProbe::LocalValueProbe(QObject *parent) : QObject(parent),
+    m_generation(0), m_pending(false), m_pendingGeneration(0),
+    m_runningGeneration(0), m_runningRevision(0), m_cacheRevision(0)
+{
+    m_cache.setMaxCost(PROBECACHESIZE);
+
+    m_timer = new QTimer(this);
+    m_timer->setSingleShot(true);
+    m_timer->setInterval(PROBEINTERVAL);
+    connect(m_timer, SIGNAL(timeout()), this, SLOT(doEvaluate()));
+
+    connect(&m_watcher, SIGNAL(finished()), this, SLOT(doFinished()));
+
+    // grids are deleted with the solution
+    connect(Util::problem(), SIGNAL(solutionAboutToBeCleared()), this, SLOT(cancel()));
+    connect(Util::problem(), SIGNAL(solutionAboutToBeUpdated()), this, SLOT(cancel()));
+}
+
+LocalValueProbe::~LocalValueProbe()
+{
+    m_watcher.waitForFinished();
+}
+
+QByteArray LocalValueProbe::key(const Point3 &point)
+{
+    return QByteArray((const char *) &point.x, sizeof(double)) +
+            QByteArray((const char *) &point.y, sizeof(double)) +
+            QByteArray((const char *) &point.z, sizeof(double));
+}
+
+LocalValueProbeResult LocalValueProbe::evaluate(QSharedPointer<FieldInterpolator> interpolator, const Point3 &point)
+{
+    LocalValueProbeResult result;
+    result.point = point;
+    result.valid = interpolator->contains(point);
+    if (result.valid)
+        result.value = interpolator->value(point);
+
+    return result;
+}
+
+QVector<double> LocalValueProbe::values(const FieldInterpolator *interpolator, const QVector<Point3> &points)
+{
+    QVector<double> result(points.count());
+
+    const Point3 *pointData = points.constData();
+    double *resultData = result.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < points.count(); i++)
+    {
+        if (interpolator->contains(pointData[i]))
+            resultData[i] = interpolator->value(pointData[i]);
+        else
+            resultData[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+
+    return result;
+}
+
+void LocalValueProbe::probe(const Point3 &point)
+{
+    m_generation++;
+
+    SolutionGrid *grid = Util::problem()->solution();
+    if (!grid)
+    {
+        m_pending = false;
+
+        LocalValueProbeResult result;
+        result.point = point;
+        emit probed(result);
+        return;
+    }
+
+    if (grid->revision() != m_cacheRevision)
+    {
+        m_cache.clear();
+        m_cacheRevision = grid->revision();
+    }
+
+    // recently probed point
+    if (LocalValueProbeResult *cached = m_cache.object(key(point)))
+    {
+        m_pending = false;
+        emit probed(*cached);
+        return;
+    }
+
+    m_pending = true;
+    m_pendingPoint = point;
+    m_pendingGeneration = m_generation;
+
+    // the running evaluation starts the next one when it finishes
+    if (!m_timer->isActive() && !m_watcher.isRunning())
+        m_timer->start();
+}
+
+void LocalValueProbe::cancel()
+{
+    m_timer->stop();
+    m_watcher.waitForFinished();
+
+    // result of the finished evaluation is not reported
+    m_generation++;
+    m_pending = false;
+    m_cache.clear();
+}
+
+void LocalValueProbe::doEvaluate()
+{
+    if (!m_pending || m_watcher.isRunning())
+        return;
+
+    // the copy keeps the interpolator of the evaluated level alive
+    QSharedPointer<FieldInterpolator> interpolator = Util::problem()->interpolator();
+    m_pending = false;
+    if (interpolator.isNull())
+        return;
+
+    m_runningGeneration = m_pendingGeneration;
+    m_runningRevision = interpolator->grid()->revision();
+    m_watcher.setFuture(QtConcurrent::run(&LocalValueProbe::evaluate, interpolator, m_pendingPoint));
+}
+
+void LocalValueProbe::doFinished()
+{
+    LocalValueProbeResult result = m_watcher.result();
+
+    SolutionGrid *grid = Util::problem()->solution();
+    if (grid && grid->revision() == m_runningRevision && m_runningRevision == m_cacheRevision)
+        m_cache.insert(key(result.point), new LocalValueProbeResult(result));
+
+    // only the newest request is shown
+    if (m_runningGeneration == m_generation)
+        emit probed(result);
+
+    if (m_pending)
+        m_timer->start();
+}
@@ -0,0 +1,87 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef LOCALVALUEPROBE_H
+#define LOCALVALUEPROBE_H
+
+#include "util.h"
+
+class FieldInterpolator;
+
+struct LocalValueProbeResult
+{
+    Point3 point;
+    // point is inside the solution
+    bool valid;
+    double value;
+
+    LocalValueProbeResult() : valid(false), value(0.0) {}
+};
+
+/// asynchronous evaluation of the solution in points under the mouse
+/// requests are coalesced to the display rate (only the newest pending point is evaluated), evaluation runs
+/// off the GUI thread, results of recent points are cached for the revision of the solution and results
+/// of requests superseded by a newer one are never reported
+class LocalValueProbe : public QObject
+{
+    Q_OBJECT
+
+signals:
+    void probed(const LocalValueProbeResult &result);
+
+public slots:
+    /// waits for the running evaluation and forgets pending requests and cached results
+    /// (before the grids are deleted or updated)
+    void cancel();
+
+public:
+    LocalValueProbe(QObject *parent = 0);
+    ~LocalValueProbe();
+
+    void probe(const Point3 &point);
+
+    /// values in the points evaluated in parallel, NaN outside the solution
+    static QVector<double> values(const FieldInterpolator *interpolator, const QVector<Point3> &points);
+
+private:
+    QTimer *m_timer;
+    QFutureWatcher<LocalValueProbeResult> m_watcher;
+
+    // generation of the newest request
+    int m_generation;
+
+    bool m_pending;
+    Point3 m_pendingPoint;
+    int m_pendingGeneration;
+
+    int m_runningGeneration;
+    int m_runningRevision;
+
+    QCache<QByteArray, LocalValueProbeResult> m_cache;
+    int m_cacheRevision;
+
+    static LocalValueProbeResult evaluate(QSharedPointer<FieldInterpolator> interpolator, const Point3 &point);
+    static QByteArray key(const Point3 &point);
+
+private slots:
+    void doEvaluate();
+    void doFinished();
+};
+
+#endif // LOCALVALUEPROBE_H
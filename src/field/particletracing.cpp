@@ -0,0 +1,348 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "particletracing.h"
+#include "solutiongrid.h"
+
+// Dormand-Prince 5(4) tableau (the system is autonomous, nodes are not needed)
+static const double dpA[7][6] =
+{
+    { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+    { 1.0/5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+    { 3.0/40.0, 9.0/40.0, 0.0, 0.0, 0.0, 0.0 },
+    { 44.0/45.0, -56.0/15.0, 32.0/9.0, 0.0, 0.0, 0.0 },
+    { 19372.0/6561.0, -25360.0/2187.0, 64448.0/6561.0, -212.0/729.0, 0.0, 0.0 },
+    { 9017.0/3168.0, -355.0/33.0, 46732.0/5247.0, 49.0/176.0, -5103.0/18656.0, 0.0 },
+    { 35.0/384.0, 0.0, 500.0/1113.0, 125.0/192.0, -2187.0/6784.0, 11.0/84.0 }
+};
+// difference of the 5th and 4th order weights
+static const double dpE[7] = { 71.0/57600.0, 0.0, -71.0/16695.0, 71.0/1920.0, -17253.0/339200.0, 22.0/525.0, -1.0/40.0 };
+
+// state of the particle: position and velocity
+const int STATE_SIZE = 6;
+
+// field in the corners of the last visited cell, consecutive stages of one particle mostly stay in the same cell
+struct ParticleTracingFieldCache
+{
+    ParticleTracingFieldCache() : cell(-1) {}
+
+    int cell;
+    int i, j, k;
+    float corners[8][3];
+};
+
+static bool interpolateGradient(const SolutionGrid *grid, const float *gradients, const double *position,
+                                ParticleTracingFieldCache &cache, double *result)
+{
+    CubePoint box = grid->box();
+    Point3 step = grid->step();
+
+    double fx = (position[0] - box.start.x) / step.x;
+    double fy = (position[1] - box.start.y) / step.y;
+    double fz = (position[2] - box.start.z) / step.z;
+
+    if (fx < 0.0 || fy < 0.0 || fz < 0.0 || fx > grid->nx() - 1 || fy > grid->ny() - 1 || fz > grid->nz() - 1)
+        return false;
+
+    int i = qMin((int) fx, grid->nx() - 2);
+    int j = qMin((int) fy, grid->ny() - 2);
+    int k = qMin((int) fz, grid->nz() - 2);
+
+    int cell = grid->index(i, j, k);
+    if (cell != cache.cell)
+    {
+        cache.cell = cell;
+        cache.i = i;
+        cache.j = j;
+        cache.k = k;
+
+        // corner c = di + 2 * dj + 4 * dk
+        for (int c = 0; c < 8; c++)
+        {
+            const float *gradient = gradients + 3 * grid->index(i + (c & 1), j + ((c >> 1) & 1), k + ((c >> 2) & 1));
+            cache.corners[c][0] = gradient[0];
+            cache.corners[c][1] = gradient[1];
+            cache.corners[c][2] = gradient[2];
+        }
+    }
+
+    double tx = fx - i;
+    double ty = fy - j;
+    double tz = fz - k;
+
+    for (int d = 0; d < 3; d++)
+    {
+        double x00 = cache.corners[0][d] + tx * (cache.corners[1][d] - cache.corners[0][d]);
+        double x10 = cache.corners[2][d] + tx * (cache.corners[3][d] - cache.corners[2][d]);
+        double x01 = cache.corners[4][d] + tx * (cache.corners[5][d] - cache.corners[4][d]);
+        double x11 = cache.corners[6][d] + tx * (cache.corners[7][d] - cache.corners[6][d]);
+
+        double y0 = x00 + ty * (x10 - x00);
+        double y1 = x01 + ty * (x11 - x01);
+
+        result[d] = y0 + tz * (y1 - y0);
+    }
+
+    return true;
+}
+
+void ParticleTracingPaths::clear()
+{
+    vertices.clear();
+    velocities.clear();
+    offsets.clear();
+}
+
+ParticleTracing::ParticleTracing()
+    : m_grid(NULL), m_gridRevision(-1),
+      m_particleCount(100), m_maximumSteps(1000), m_tolerance(1e-5), m_chargeToMass(1.0),
+      m_velocityMin(0.0), m_velocityMax(0.0)
+{
+}
+
+void ParticleTracing::setGrid(const SolutionGrid *grid)
+{
+    if (m_grid == grid && (!grid || m_gridRevision == grid->revision()))
+        return;
+
+    m_grid = grid;
+    m_gridRevision = grid ? grid->revision() : -1;
+
+    m_paths.clear();
+
+    prepare();
+}
+
+void ParticleTracing::clear()
+{
+    // gradients of the grid are kept, they are recomputed only when the grid or its revision changes
+    m_seeds.clear();
+    m_paths.clear();
+    m_velocityMin = 0.0;
+    m_velocityMax = 0.0;
+}
+
+void ParticleTracing::prepare()
+{
+    m_field.clear();
+
+    if (m_grid)
+        m_grid->gradients(m_field);
+}
+
+QList<Point3> ParticleTracing::seeds() const
+{
+    if (!m_seeds.isEmpty())
+        return m_seeds;
+
+    // Halton sequence (bases 2, 3, 5) covers the box evenly for any number of particles
+    CubePoint box = m_grid->box();
+    const int base[3] = { 2, 3, 5 };
+
+    QList<Point3> seeds;
+    for (int p = 1; p <= m_particleCount; p++)
+    {
+        double coordinate[3];
+        for (int d = 0; d < 3; d++)
+        {
+            double f = 1.0;
+            double r = 0.0;
+            for (int n = p; n > 0; n /= base[d])
+            {
+                f /= base[d];
+                r += f * (n % base[d]);
+            }
+            coordinate[d] = r;
+        }
+
+        seeds.append(Point3(box.start.x + coordinate[0] * box.width(),
+                            box.start.y + coordinate[1] * box.height(),
+                            box.start.z + coordinate[2] * box.deep()));
+    }
+
+    return seeds;
+}
+
+void ParticleTracing::trace()
+{
+    m_paths.clear();
+    m_velocityMin = 0.0;
+    m_velocityMax = 0.0;
+
+    if (!m_grid)
+        return;
+
+    QVector<Point3> seedPoints = seeds().toVector();
+    int count = seedPoints.size();
+
+    QVector<QVector<float> > pathVertices(count);
+    QVector<QVector<float> > pathVelocities(count);
+    QVector<float> *vertices = pathVertices.data();
+    QVector<float> *velocities = pathVelocities.data();
+    const Point3 *seedsData = seedPoints.constData();
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int p = 0; p < count; p++)
+        tracePath(seedsData[p], vertices[p], velocities[p]);
+
+    // one buffer for all paths
+    m_paths.offsets.resize(count + 1);
+    m_paths.offsets[0] = 0;
+    for (int p = 0; p < count; p++)
+        m_paths.offsets[p + 1] = m_paths.offsets[p] + pathVelocities[p].size();
+
+    m_paths.vertices.resize(3 * m_paths.offsets[count]);
+    m_paths.velocities.resize(m_paths.offsets[count]);
+
+    float *allVertices = m_paths.vertices.data();
+    float *allVelocities = m_paths.velocities.data();
+    const int *offsets = m_paths.offsets.constData();
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int p = 0; p < count; p++)
+    {
+        if (pathVelocities[p].isEmpty())
+            continue;
+
+        memcpy(allVertices + 3 * offsets[p], pathVertices[p].constData(), 3 * pathVelocities[p].size() * sizeof(float));
+        memcpy(allVelocities + offsets[p], pathVelocities[p].constData(), pathVelocities[p].size() * sizeof(float));
+    }
+
+    if (!m_paths.velocities.isEmpty())
+    {
+        m_velocityMin = numeric_limits<double>::max();
+        m_velocityMax = -numeric_limits<double>::max();
+        foreach (float velocity, m_paths.velocities)
+        {
+            m_velocityMin = qMin(m_velocityMin, (double) velocity);
+            m_velocityMax = qMax(m_velocityMax, (double) velocity);
+        }
+    }
+}
+
+void ParticleTracing::tracePath(const Point3 &seed, QVector<float> &vertices, QVector<float> &velocities) const
+{
+    const float *gradients = m_field.constData();
+    ParticleTracingFieldCache cache;
+
+    // scales of the problem
+    CubePoint box = m_grid->box();
+    double length = sqrt(box.width() * box.width() + box.height() * box.height() + box.deep() * box.deep());
+
+    // state derivative, dx/dt = v, dv/dt = - q/m grad(u)
+    double y[STATE_SIZE] = { seed.x, seed.y, seed.z, 0.0, 0.0, 0.0 };
+    double k[7][STATE_SIZE];
+    double gradient[3];
+
+    if (!interpolateGradient(m_grid, gradients, y, cache, gradient))
+        return;
+
+    double acceleration = m_chargeToMass * sqrt(gradient[0] * gradient[0] + gradient[1] * gradient[1] + gradient[2] * gradient[2]);
+    if (acceleration < EPS_ZERO)
+        return;
+
+    for (int d = 0; d < 3; d++)
+    {
+        k[0][d] = y[3 + d];
+        k[0][3 + d] = - m_chargeToMass * gradient[d];
+    }
+
+    // time to cross the box with the initial acceleration
+    double timeScale = sqrt(2.0 * length / acceleration);
+    double velocityScale = length / timeScale;
+
+    double h = 1e-3 * timeScale;
+    double hMin = 1e-12 * timeScale;
+
+    vertices << y[0] << y[1] << y[2];
+    velocities << 0.0;
+
+    int steps = 0;
+    int attempts = 0;
+    while (steps < m_maximumSteps && attempts < 10 * m_maximumSteps)
+    {
+        attempts++;
+
+        // stages
+        double stage[STATE_SIZE];
+        bool inside = true;
+        for (int s = 1; s < 7 && inside; s++)
+        {
+            for (int i = 0; i < STATE_SIZE; i++)
+            {
+                stage[i] = y[i];
+                for (int j = 0; j < s; j++)
+                    stage[i] += h * dpA[s][j] * k[j][i];
+            }
+
+            inside = interpolateGradient(m_grid, gradients, stage, cache, gradient);
+            if (inside)
+            {
+                for (int d = 0; d < 3; d++)
+                {
+                    k[s][d] = stage[3 + d];
+                    k[s][3 + d] = - m_chargeToMass * gradient[d];
+                }
+            }
+        }
+
+        if (!inside)
+        {
+            // particle leaves the grid, approach the boundary by shorter steps
+            h /= 2.0;
+            if (h < hMin)
+                break;
+            continue;
+        }
+
+        // the last stage is the new state (FSAL)
+        double error = 0.0;
+        for (int i = 0; i < STATE_SIZE; i++)
+        {
+            double e = 0.0;
+            for (int s = 0; s < 7; s++)
+                e += h * dpE[s] * k[s][i];
+
+            double scale = ((i < 3) ? length : velocityScale) + qMax(fabs(y[i]), fabs(stage[i]));
+            error = qMax(error, fabs(e) / (m_tolerance * scale));
+        }
+
+        if (error <= 1.0)
+        {
+            for (int i = 0; i < STATE_SIZE; i++)
+            {
+                y[i] = stage[i];
+                k[0][i] = k[6][i];
+            }
+
+            vertices << y[0] << y[1] << y[2];
+            velocities << sqrt(y[3] * y[3] + y[4] * y[4] + y[5] * y[5]);
+
+            steps++;
+        }
+
+        // step control
+        double factor = (error > 0.0) ? 0.9 * pow(error, -0.2) : 5.0;
+        h *= qBound(0.2, factor, 5.0);
+
+        // singular field (particle falls into the source)
+        if (h < hMin)
+            break;
+    }
+}
@@ -0,0 +1,97 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef PARTICLETRACING_H
+#define PARTICLETRACING_H
+
+#include "util.h"
+
+class SolutionGrid;
+
+/// polylines of all traced particles in one contiguous buffer
+struct ParticleTracingPaths
+{
+    QVector<float> vertices; // x, y, z
+    QVector<float> velocities; // magnitude of velocity in the vertex
+    QVector<int> offsets; // first vertex of every path, the last item is the total number of vertices
+
+    inline int pathCount() const { return offsets.isEmpty() ? 0 : offsets.size() - 1; }
+    inline int first(int path) const { return offsets[path]; }
+    inline int count(int path) const { return offsets[path + 1] - offsets[path]; }
+
+    void clear();
+};
+
+/// charged particles moving in the field E = -grad(u) of the solution grid
+/// particles are independent and integrated in parallel by the embedded Runge-Kutta 5(4) method (Dormand-Prince)
+/// with adaptive time step, the field is interpolated from point gradients cached for the grid revision
+class ParticleTracing
+{
+public:
+    ParticleTracing();
+
+    void setGrid(const SolutionGrid *grid);
+
+    inline int particleCount() const { return m_particleCount; }
+    inline void setParticleCount(int count) { m_particleCount = count; }
+
+    inline int maximumSteps() const { return m_maximumSteps; }
+    inline void setMaximumSteps(int steps) { m_maximumSteps = steps; }
+
+    inline double tolerance() const { return m_tolerance; }
+    inline void setTolerance(double tolerance) { m_tolerance = tolerance; }
+
+    inline double chargeToMass() const { return m_chargeToMass; }
+    inline void setChargeToMass(double chargeToMass) { m_chargeToMass = chargeToMass; }
+
+    /// starting positions, quasi-random (Halton) points inside the grid if not set
+    inline void setSeeds(const QList<Point3> &seeds) { m_seeds = seeds; }
+
+    void trace();
+    /// clears the paths, the gradients of the grid are kept
+    void clear();
+
+    inline const ParticleTracingPaths &paths() const { return m_paths; }
+    inline double velocityMin() const { return m_velocityMin; }
+    inline double velocityMax() const { return m_velocityMax; }
+
+private:
+    const SolutionGrid *m_grid;
+    int m_gridRevision;
+
+    int m_particleCount;
+    int m_maximumSteps;
+    double m_tolerance;
+    double m_chargeToMass;
+
+    QList<Point3> m_seeds;
+
+    // grad(u) in grid points (E = -grad(u), the sign is applied in the equation of motion)
+    QVector<float> m_field;
+
+    ParticleTracingPaths m_paths;
+    double m_velocityMin;
+    double m_velocityMax;
+
+    void prepare();
+    QList<Point3> seeds() const;
+    void tracePath(const Point3 &seed, QVector<float> &vertices, QVector<float> &velocities) const;
+};
+
+#endif // PARTICLETRACING_H
@@ -18,12 +18,21 @@
 // Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
 
 #include "problem.h"
+#include "solutiongrid.h"
+#include "solutionstore.h"
+#include "solver.h"
+#include "fieldinterpolator.h"
+#include "statistics.h"
+#include "integralvalue.h"
+#include "derivedquantity.h"
 
 #include "scene.h"
 #include "scenebasic.h"
 #include "scenenode.h"
 #include "logview.h"
 
+#include "util/constants.h"
+
 ProblemConfig::ProblemConfig(QWidget *parent) : QObject(parent)
 {
     clear();
@@ -47,6 +56,11 @@ Problem::Problem()
     m_timeElapsed = QTime(0, 0);
     m_isSolved = false;
     m_isSolving = false;
+    m_solveGeneration = 0;
+    m_solution = NULL;
+    m_solutionStore = new SolutionStore();
+    m_statistics = new SolutionStatistics(m_solutionStore);
+    m_integrals << new LineIntegralValue() << new SurfaceIntegralValue() << new VolumeIntegralValue();
 
     m_config = new ProblemConfig();
 
@@ -62,15 +76,155 @@ Problem::~Problem()
     clearSolution();
     clearFieldsAndConfig();
 
+    qDeleteAll(m_derivedQuantities);
+
     delete m_config;
+    qDeleteAll(m_integrals);
+    delete m_statistics;
+    delete m_solutionStore;
 }
 
 void Problem::clearSolution()
 {
+    // running solve is cancelled, it stays solving until its level is finished
+    m_solveGeneration++;
     m_isSolved = false;
-    m_isSolving = false;
     m_timeStep = 0;
     m_timeElapsed = QTime(0, 0);
+
+    if (!m_solutionStore->isEmpty())
+        emit solutionAboutToBeCleared();
+
+    m_interpolator.clear();
+    m_statistics->clear();
+    foreach (IntegralValue *integral, m_integrals)
+        integral->clear();
+    foreach (DerivedQuantity *quantity, m_derivedQuantities)
+        quantity->clear();
+    m_solutionStore->clear();
+    m_solution = NULL;
+    m_solver.clear();
+    m_snapshot = SceneSnapshot();
+}
+
+void Problem::doSceneInvalidated()
+{
+    // solve of the snapshot continues, the result is checked when finished
+    if (m_isSolving)
+        return;
+
+    if (!isStale())
+        return;
+
+    if (Util::config()->solverIncremental)
+    {
+        if (solveIncremental())
+            return;
+
+        // after the edit is finished (not for a cleared scene)
+        if (!Util::scene()->nodes->isEmpty())
+            QTimer::singleShot(0, this, SLOT(doSolveFull()));
+    }
+
+    clearSolution();
+}
+
+void Problem::doSolveFull()
+{
+    // solved in the meantime (e.g. by a script)
+    if (isSolving() || isSolved() || Util::scene()->nodes->isEmpty())
+        return;
+
+    solve();
+}
+
+bool Problem::solveIncremental()
+{
+    if (!m_isSolved || m_isSolving || m_solver.isNull())
+        return false;
+
+    SceneSnapshot snapshot = Util::scene()->snapshot();
+    if (snapshot.isEmpty())
+        return false;
+
+    QList<Point3> removed;
+    QList<Point3> added;
+    snapshot.difference(m_snapshot, removed, added);
+    if (removed.count() + added.count() > SOLVERINCREMENTALFRACTION * snapshot.count())
+        return false;
+
+    // grids and softening belong to the solved box, it is kept while the new sources lie inside it
+    CubePoint box = m_solver->box();
+    foreach (Point3 source, added)
+    {
+        if (source.x < box.start.x || source.x > box.end.x ||
+                source.y < box.start.y || source.y > box.end.y ||
+                source.z < box.start.z || source.z > box.end.z)
+            return false;
+    }
+
+    // background evaluations reading the grids are finished first
+    emit solutionAboutToBeUpdated();
+
+    QTime elapsedTime;
+    elapsedTime.start();
+
+    QSharedPointer<Solver> solver(new Solver(snapshot.points(), box, m_solver->coarse()));
+
+    // all steps of the store are kept consistent
+    for (int step = 0; step < m_solutionStore->count(); step++)
+        solver->update(m_solutionStore->grid(step), removed, added);
+
+    m_solver = solver;
+    m_snapshot = snapshot;
+    m_interpolator = QSharedPointer<FieldInterpolator>(new FieldInterpolator(m_solution, solver));
+
+    Util::log()->printDebug(tr("Solver"), tr("incremental update: %1 removed, %2 added sources (%3 ms)").
+                            arg(removed.count()).
+                            arg(added.count()).
+                            arg(elapsedTime.elapsed()));
+
+    emit solved();
+
+    return true;
+}
+
+bool Problem::isStale() const
+{
+    return m_isSolved && m_snapshot != Util::scene()->snapshot();
+}
+
+void Problem::setDerivedQuantity(const QString &name, const QString &expression)
+{
+    // compiled before the previous definition is replaced
+    DerivedQuantity *quantity = new DerivedQuantity(name, expression);
+
+    delete m_derivedQuantities.value(name, NULL);
+    m_derivedQuantities[name] = quantity;
+
+    emit derivedQuantitiesChanged();
+}
+
+void Problem::removeDerivedQuantity(const QString &name)
+{
+    if (!m_derivedQuantities.contains(name))
+        return;
+
+    delete m_derivedQuantities.take(name);
+
+    emit derivedQuantitiesChanged();
+}
+
+const SolutionGrid *Problem::quantity(const QString &name)
+{
+    if (!m_solution)
+        return NULL;
+
+    DerivedQuantity *quantity = m_derivedQuantities.value(name, NULL);
+    if (!quantity)
+        return m_solution;
+
+    return quantity->grid(m_solution);
 }
 
 void Problem::clearFieldsAndConfig()
@@ -86,13 +240,70 @@ void Problem::solve()
     if (isSolving())
         return;
 
+    if (Util::scene()->nodes->isEmpty())
+    {
+        Util::log()->printError(tr("Solver"), tr("Geometry does not contain any node."));
+        return;
+    }
+
+    clearSolution();
+    m_isSolving = true;
+    int generation = m_solveGeneration;
+    emit solvingChanged(true);
+
     // start
     QTime elapsedTime;
     elapsedTime.start();
 
-    //setActualTime(0.);
+    Indicator::openProgress();
+
+    // sources in nodes of the snapshot, the scene can be edited while solving
+    SceneSnapshot snapshot = Util::scene()->snapshot();
+
+    // solver is kept for the direct evaluation near the sources (local copy survives clearing during the preview)
+    QSharedPointer<Solver> solver(new Solver(snapshot.points(), Solver::evaluationBox(snapshot.boundingBox()), SOLVERGRIDCOARSE));
+
+    // progressive solve starts on the coarsest grid, every finer level reuses the previous one
+    int levels = Util::config()->solverGridLevels;
+    int first = Util::config()->solverProgressive ? 0 : levels;
+    for (int level = first; level <= levels; level++)
+    {
+        // level is evaluated in the background (events are processed meanwhile), from a copy of the previous level
+        // which can be cleared in the meantime
+        QSharedPointer<SolutionGrid> previous(m_solution ? new SolutionGrid(*m_solution) : NULL);
+
+        QFutureWatcher<SolutionGrid *> watcher;
+        QEventLoop loop;
+        connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+        watcher.setFuture(QtConcurrent::run(solver.data(), &Solver::solve, level, (const SolutionGrid *) previous.data()));
+        loop.exec();
+
+        SolutionGrid *grid = watcher.result();
 
-    // TODO: solve
+        // solution was cleared (e.g. settings have changed during the solve)
+        if (generation != m_solveGeneration)
+        {
+            delete grid;
+            break;
+        }
+
+        // result records the snapshot (and solver) it belongs to
+        m_solutionStore->append(level, grid);
+        m_solution = grid;
+        m_solver = solver;
+        m_snapshot = snapshot;
+        m_interpolator = QSharedPointer<FieldInterpolator>(new FieldInterpolator(grid, solver));
+        m_isSolved = true;
+
+        Util::log()->printMessage(tr("Solver"), tr("level %1: %2 points (%3 ms)").
+                                  arg(level).
+                                  arg(grid->count()).
+                                  arg(elapsedTime.elapsed()));
+        Indicator::setProgress((double) (level - first + 1) / (levels - first + 1));
+
+        if (level < levels)
+            emit solutionRefined(level);
+    }
 
     // delete temp file
     if (config()->fileName() == tempProblemFileName() + ".a2d")
@@ -102,9 +313,23 @@ void Problem::solve()
     }
 
     m_isSolving = false;
+    emit solvingChanged(false);
 
     m_timeElapsed = milisecondsToTime(elapsedTime.elapsed());
 
     // close indicator progress
     Indicator::closeProgress();
+
+    // result of this solve (not cleared in the meantime)
+    if (generation != m_solveGeneration || !m_isSolved)
+        return;
+
+    emit solved();
+
+    // geometry edited during the solve, the solution is updated (or cleared) as after any edit
+    if (isStale())
+    {
+        Util::log()->printWarning(tr("Solver"), tr("Geometry has changed during the solve."));
+        doSceneInvalidated();
+    }
 }
@@ -2,11 +2,16 @@
 #define PROBLEM_H
 
 #include "util.h"
+#include "scenesnapshot.h"
 
 class Problem;
-
-//template <typename Scalar>
-//class Solver;
+class SolutionGrid;
+class SolutionStore;
+class SolutionStatistics;
+class IntegralValue;
+class Solver;
+class FieldInterpolator;
+class DerivedQuantity;
 
 class ProblemConfig : public QObject
 {
@@ -63,9 +68,24 @@ signals:
     void meshed();
     void solved();
 
+    /// grids of the solution are going to be deleted
+    void solutionAboutToBeCleared();
+    /// grids of the solution are going to be changed in place (incremental update)
+    void solutionAboutToBeUpdated();
+
+    /// partial solution of the progressive solve is available (solved() follows after the finest level),
+    /// levels start from 0
+    void solutionRefined(int level);
+
+    /// solve has started or finished (also when it was cancelled by clearSolution())
+    void solvingChanged(bool solving);
+
     /// emited when an field is added or removed. Menus need to adjusted
     void fieldsChanged();
 
+    /// derived quantity is defined or removed
+    void derivedQuantitiesChanged();
+
     /// emited when an field is added or removed. Menus need to adjusted
     void couplingsChanged();
 
@@ -74,6 +94,13 @@ public slots:
     void clearSolution();
     void clearFieldsAndConfig();
 
+    /// solution is updated (or cleared) if the geometry differs from its snapshot (kept while solving)
+    void doSceneInvalidated();
+
+private slots:
+    /// full solve after an edit too large for solveIncremental()
+    void doSolveFull();
+
 public:
     Problem();
     ~Problem();
@@ -87,16 +114,68 @@ public:
     // solve
     void solve();
 
+    /// updates the solution of the previous geometry by superposition (contributions of the removed and moved
+    /// sources are subtracted, the new ones added), cost proportional to the number of changed sources,
+    /// the solved box (and softening) is kept while the edited sources stay inside it,
+    /// returns false if the change is too large or a source leaves the box (full solve is needed)
+    bool solveIncremental();
+
     bool isSolved() const {  return m_isSolved; }
     bool isSolving() const { return m_isSolving; }
 
+    /// sampled solution, NULL if the problem is not solved
+    inline SolutionGrid *solution() const { return m_solution; }
+
+    /// geometry the solution belongs to (the scene can be edited while solving)
+    inline SceneSnapshot snapshot() const { return m_snapshot; }
+    /// geometry of the scene differs from the snapshot of the solution
+    bool isStale() const;
+
+    /// all steps of the last solve (levels of the progressive solve), the last one is solution()
+    inline SolutionStore *solutionStore() const { return m_solutionStore; }
+
+    /// statistics of the solution quantities (cached per quantity and step of the store)
+    inline SolutionStatistics *statistics() const { return m_statistics; }
+
+    /// integrals over the selected nodes (1 - line, 2 - surface, 3 - volume), contributions of the elements
+    /// are cached between the evaluations and dropped with the solution
+    inline IntegralValue *integral(int dimension) const { return m_integrals[dimension - 1]; }
+
+    /// values of the solution() in arbitrary points, NULL if the problem is not solved
+    /// (copy of the pointer keeps the interpolator alive while the solution is refined)
+    inline QSharedPointer<FieldInterpolator> interpolator() const { return m_interpolator; }
+
+    /// defines or redefines the quantity, throws ParserException if the expression is not valid
+    void setDerivedQuantity(const QString &name, const QString &expression);
+    void removeDerivedQuantity(const QString &name);
+    inline QStringList derivedQuantities() const { return m_derivedQuantities.keys(); }
+    inline DerivedQuantity *derivedQuantity(const QString &name) const { return m_derivedQuantities.value(name, NULL); }
+
+    /// values of the derived quantity in the grid of the solution (computed at first use),
+    /// solution() for empty or unknown name
+    const SolutionGrid *quantity(const QString &name = "");
+
 private:
     ProblemConfig *m_config;
 
     QTime m_timeElapsed;
     bool m_isSolving;
+    /// increased by clearSolution(), the running solve is cancelled when it changes
+    int m_solveGeneration;
     int m_timeStep;
     bool m_isSolved;
+
+    SolutionGrid *m_solution;
+    SolutionStore *m_solutionStore;
+    SolutionStatistics *m_statistics;
+    QList<IntegralValue *> m_integrals;
+
+    SceneSnapshot m_snapshot;
+
+    QSharedPointer<Solver> m_solver;
+    QSharedPointer<FieldInterpolator> m_interpolator;
+
+    QMap<QString, DerivedQuantity *> m_derivedQuantities;
 };
 
 #endif // PROBLEM_H
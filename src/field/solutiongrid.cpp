@@ -0,0 +1,121 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "solutiongrid.h"
+
+static int lastRevision = 0;
+
+SolutionGrid::SolutionGrid(const CubePoint &box, int nx, int ny, int nz)
+    : m_box(box), m_nx(nx), m_ny(ny), m_nz(nz), m_revision(++lastRevision)
+{
+    assert(nx > 1 && ny > 1 && nz > 1);
+
+    m_step = Point3((box.end.x - box.start.x) / (nx - 1),
+                    (box.end.y - box.start.y) / (ny - 1),
+                    (box.end.z - box.start.z) / (nz - 1));
+
+    m_values.fill(0.0, count());
+}
+
+void SolutionGrid::touch()
+{
+    m_revision = ++lastRevision;
+}
+
+void SolutionGrid::gradients(QVector<float> &result) const
+{
+    result.resize(3 * count());
+
+    float *gradients = result.data();
+    const double *values = m_values.constData();
+
+#pragma omp parallel for
+    for (int k = 0; k < m_nz; k++)
+    {
+        int k0 = (k > 0) ? k - 1 : k;
+        int k1 = (k < m_nz - 1) ? k + 1 : k;
+
+        for (int j = 0; j < m_ny; j++)
+        {
+            int j0 = (j > 0) ? j - 1 : j;
+            int j1 = (j < m_ny - 1) ? j + 1 : j;
+
+            for (int i = 0; i < m_nx; i++)
+            {
+                int i0 = (i > 0) ? i - 1 : i;
+                int i1 = (i < m_nx - 1) ? i + 1 : i;
+
+                float *gradient = gradients + 3 * index(i, j, k);
+                gradient[0] = (values[index(i1, j, k)] - values[index(i0, j, k)]) / ((i1 - i0) * m_step.x);
+                gradient[1] = (values[index(i, j1, k)] - values[index(i, j0, k)]) / ((j1 - j0) * m_step.y);
+                gradient[2] = (values[index(i, j, k1)] - values[index(i, j, k0)]) / ((k1 - k0) * m_step.z);
+            }
+        }
+    }
+}
+
+double SolutionGrid::interpolate(const Point3 &point) const
+{
+    double fx = qBound(0.0, (point.x - m_box.start.x) / m_step.x, m_nx - 1.0);
+    double fy = qBound(0.0, (point.y - m_box.start.y) / m_step.y, m_ny - 1.0);
+    double fz = qBound(0.0, (point.z - m_box.start.z) / m_step.z, m_nz - 1.0);
+
+    int i = qMin((int) fx, m_nx - 2);
+    int j = qMin((int) fy, m_ny - 2);
+    int k = qMin((int) fz, m_nz - 2);
+
+    double tx = fx - i;
+    double ty = fy - j;
+    double tz = fz - k;
+
+    double x00 = value(i, j, k) + tx * (value(i + 1, j, k) - value(i, j, k));
+    double x10 = value(i, j + 1, k) + tx * (value(i + 1, j + 1, k) - value(i, j + 1, k));
+    double x01 = value(i, j, k + 1) + tx * (value(i + 1, j, k + 1) - value(i, j, k + 1));
+    double x11 = value(i, j + 1, k + 1) + tx * (value(i + 1, j + 1, k + 1) - value(i, j + 1, k + 1));
+
+    double y0 = x00 + ty * (x10 - x00);
+    double y1 = x01 + ty * (x11 - x01);
+
+    return y0 + tz * (y1 - y0);
+}
+
+void SolutionGrid::stencil(const Point3 &point, int indices[8], double weights[8]) const
+{
+    double fx = qBound(0.0, (point.x - m_box.start.x) / m_step.x, m_nx - 1.0);
+    double fy = qBound(0.0, (point.y - m_box.start.y) / m_step.y, m_ny - 1.0);
+    double fz = qBound(0.0, (point.z - m_box.start.z) / m_step.z, m_nz - 1.0);
+
+    int i = qMin((int) fx, m_nx - 2);
+    int j = qMin((int) fy, m_ny - 2);
+    int k = qMin((int) fz, m_nz - 2);
+
+    double tx = fx - i;
+    double ty = fy - j;
+    double tz = fz - k;
+
+    for (int c = 0; c < 8; c++)
+    {
+        int di = c & 1;
+        int dj = (c >> 1) & 1;
+        int dk = (c >> 2) & 1;
+
+        indices[c] = index(i + di, j + dj, k + dk);
+        weights[c] = (di ? tx : 1.0 - tx) * (dj ? ty : 1.0 - ty) * (dk ? tz : 1.0 - tz);
+    }
+}
@@ -0,0 +1,86 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef SOLUTIONGRID_H
+#define SOLUTIONGRID_H
+
+#include "util.h"
+
+/// scalar values sampled on an uniform grid covering the evaluation box
+/// values are stored x-fastest, index = (k * ny + j) * nx + i
+class SolutionGrid
+{
+public:
+    SolutionGrid(const CubePoint &box, int nx, int ny, int nz);
+
+    inline CubePoint box() const { return m_box; }
+    inline int nx() const { return m_nx; }
+    inline int ny() const { return m_ny; }
+    inline int nz() const { return m_nz; }
+    inline int count() const { return m_nx * m_ny * m_nz; }
+    inline Point3 step() const { return m_step; }
+
+    inline int index(int i, int j, int k) const { return (k * m_ny + j) * m_nx + i; }
+    inline Point3 point(int i, int j, int k) const
+    {
+        return Point3(m_box.start.x + i * m_step.x,
+                      m_box.start.y + j * m_step.y,
+                      m_box.start.z + k * m_step.z);
+    }
+
+    inline double value(int i, int j, int k) const { return m_values[index(i, j, k)]; }
+    inline void setValue(int i, int j, int k, double value) { m_values[index(i, j, k)] = value; }
+
+    inline const double *values() const { return m_values.constData(); }
+    inline double *values() { return m_values.data(); }
+
+    inline bool contains(const Point3 &point) const
+    {
+        return (point.x >= m_box.start.x && point.x <= m_box.end.x &&
+                point.y >= m_box.start.y && point.y <= m_box.end.y &&
+                point.z >= m_box.start.z && point.z <= m_box.end.z);
+    }
+
+    /// trilinear interpolation inside the box
+    double interpolate(const Point3 &point) const;
+
+    /// indices of the corners of the cell containing the point (clamped to the box) and their trilinear weights,
+    /// interpolate() == sum(weights[c] * values()[indices[c]])
+    void stencil(const Point3 &point, int indices[8], double weights[8]) const;
+
+    /// gradients in grid points (x, y, z for each point), central differences inside, one-sided on the boundary
+    void gradients(QVector<float> &result) const;
+
+    /// revision is renewed by the solver whenever the values change (unique among all grids),
+    /// postprocessor caches built over the grid compare it to decide whether they are still valid
+    inline int revision() const { return m_revision; }
+    void touch();
+
+private:
+    CubePoint m_box;
+    int m_nx;
+    int m_ny;
+    int m_nz;
+    Point3 m_step;
+
+    QVector<double> m_values;
+    int m_revision;
+};
+
+#endif // SOLUTIONGRID_H
@@ -0,0 +1,101 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "solutionstore.h"
+#include "solutiongrid.h"
+
+SolutionStore::SolutionStore()
+{
+}
+
+SolutionStore::~SolutionStore()
+{
+    clear();
+}
+
+void SolutionStore::clear()
+{
+    qDeleteAll(m_grids);
+    m_grids.clear();
+    m_timeLevels.clear();
+}
+
+void SolutionStore::append(double time, SolutionGrid *grid)
+{
+    m_timeLevels.append(time);
+    m_grids.append(grid);
+}
+
+// **************************************************************************************************
+
+TimeHistory::TimeHistory(const SolutionStore *store)
+    : m_store(store), m_stepCount(0)
+{
+}
+
+void TimeHistory::clear()
+{
+    m_points.clear();
+    m_timeLevels.clear();
+    m_stepCount = 0;
+    m_values.clear();
+}
+
+void TimeHistory::extract(const QList<Point3> &points)
+{
+    clear();
+
+    m_points = points.toVector();
+    m_timeLevels = m_store->timeLevels();
+    m_stepCount = m_store->count();
+    m_values.resize(m_points.count() * m_stepCount);
+
+    if (m_points.isEmpty() || m_stepCount == 0)
+        return;
+
+    const Point3 *pointData = m_points.constData();
+    double *valueData = m_values.data();
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int p = 0; p < m_points.count(); p++)
+    {
+        double *result = valueData + p * m_stepCount;
+
+        for (int step = 0; step < m_stepCount; step++)
+        {
+            const SolutionGrid *grid = m_store->grid(step);
+            if (!grid->contains(pointData[p]))
+            {
+                result[step] = numeric_limits<double>::quiet_NaN();
+                continue;
+            }
+
+            int indices[8];
+            double weights[8];
+            grid->stencil(pointData[p], indices, weights);
+
+            const double *values = grid->values();
+
+            double sum = 0.0;
+            for (int c = 0; c < 8; c++)
+                sum += weights[c] * values[indices[c]];
+            result[step] = sum;
+        }
+    }
+}
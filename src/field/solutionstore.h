@@ -0,0 +1,76 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef SOLUTIONSTORE_H
+#define SOLUTIONSTORE_H
+
+#include "util.h"
+
+class SolutionGrid;
+
+/// solutions of the consecutive steps of the problem, the store owns the grids
+class SolutionStore
+{
+public:
+    SolutionStore();
+    ~SolutionStore();
+
+    void clear();
+    void append(double time, SolutionGrid *grid);
+
+    inline int count() const { return m_grids.count(); }
+    inline bool isEmpty() const { return m_grids.isEmpty(); }
+
+    inline const QList<double> &timeLevels() const { return m_timeLevels; }
+    inline SolutionGrid *grid(int step) const { return m_grids[step]; }
+    inline SolutionGrid *last() const { return m_grids.isEmpty() ? NULL : m_grids.last(); }
+
+private:
+    QList<double> m_timeLevels;
+    QList<SolutionGrid *> m_grids;
+};
+
+/// values in the probe points for all steps of the store (NaN outside the grid of a step), extracted in a single pass,
+/// points are processed in parallel and every point walks through all steps (point-major),
+/// values of one point are stored contiguously
+class TimeHistory
+{
+public:
+    TimeHistory(const SolutionStore *store);
+
+    void extract(const QList<Point3> &points);
+    void clear();
+
+    inline int pointCount() const { return m_points.count(); }
+    inline int stepCount() const { return m_stepCount; }
+
+    inline const QList<double> &timeLevels() const { return m_timeLevels; }
+    inline const double *values(int point) const { return m_values.constData() + point * m_stepCount; }
+    inline double value(int point, int step) const { return m_values[point * m_stepCount + step]; }
+
+private:
+    const SolutionStore *m_store;
+
+    QVector<Point3> m_points;
+    QList<double> m_timeLevels;
+    int m_stepCount;
+    QVector<double> m_values;
+};
+
+#endif // SOLUTIONSTORE_H
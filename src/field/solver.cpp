@@ -0,0 +1,172 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "solver.h"
+#include "solutiongrid.h"
+
+Solver::Solver(const QList<Point3> &sources, const CubePoint &box, int coarse)
+    : m_box(box), m_coarse(coarse)
+{
+    m_x.reserve(sources.count());
+    m_y.reserve(sources.count());
+    m_z.reserve(sources.count());
+    foreach (Point3 source, sources)
+    {
+        m_x.append(source.x);
+        m_y.append(source.y);
+        m_z.append(source.z);
+    }
+
+    m_softening = 1e-3 * sqrt(box.width() * box.width() + box.height() * box.height() + box.deep() * box.deep());
+}
+
+CubePoint Solver::evaluationBox(const CubePoint &boundingBox)
+{
+    // margin around the sources, flat or empty scenes get a cube
+    double size = qMax(boundingBox.width(), qMax(boundingBox.height(), boundingBox.deep()));
+    if (size < EPS_ZERO)
+        size = 1.0;
+    double margin = 0.25 * size;
+
+    Point3 center = (boundingBox.start + boundingBox.end) / 2.0;
+    Point3 half(qMax(boundingBox.width() / 2.0, 0.25 * size) + margin,
+                qMax(boundingBox.height() / 2.0, 0.25 * size) + margin,
+                qMax(boundingBox.deep() / 2.0, 0.25 * size) + margin);
+
+    return CubePoint(center - half, center + half);
+}
+
+double Solver::value(const Point3 &point) const
+{
+    const double *x = m_x.constData();
+    const double *y = m_y.constData();
+    const double *z = m_z.constData();
+    double softening2 = m_softening * m_softening;
+
+    double sum = 0.0;
+    for (int s = 0; s < m_x.size(); s++)
+    {
+        double dx = point.x - x[s];
+        double dy = point.y - y[s];
+        double dz = point.z - z[s];
+        sum += 1.0 / sqrt(dx*dx + dy*dy + dz*dz + softening2);
+    }
+
+    return sum / (4.0 * M_PI);
+}
+
+void Solver::update(SolutionGrid *grid, const QList<Point3> &removed, const QList<Point3> &added) const
+{
+    // changed sources with their signs (structure of arrays)
+    int count = removed.count() + added.count();
+    QVector<double> x(count), y(count), z(count), sign(count);
+    for (int s = 0; s < count; s++)
+    {
+        Point3 source = (s < removed.count()) ? removed[s] : added[s - removed.count()];
+        x[s] = source.x;
+        y[s] = source.y;
+        z[s] = source.z;
+        sign[s] = (s < removed.count()) ? -1.0 : 1.0;
+    }
+
+    const double *px = x.constData();
+    const double *py = y.constData();
+    const double *pz = z.constData();
+    const double *ps = sign.constData();
+
+    int nx = grid->nx();
+    int ny = grid->ny();
+    int nz = grid->nz();
+    double softening2 = m_softening * m_softening;
+    double *values = grid->values();
+
+#pragma omp parallel for
+    for (int k = 0; k < nz; k++)
+    {
+        for (int j = 0; j < ny; j++)
+        {
+            for (int i = 0; i < nx; i++)
+            {
+                Point3 point = grid->point(i, j, k);
+
+                double sum = 0.0;
+                for (int s = 0; s < count; s++)
+                {
+                    double dx = point.x - px[s];
+                    double dy = point.y - py[s];
+                    double dz = point.z - pz[s];
+                    sum += ps[s] / sqrt(dx*dx + dy*dy + dz*dz + softening2);
+                }
+
+                values[grid->index(i, j, k)] += sum / (4.0 * M_PI);
+            }
+        }
+    }
+
+    grid->touch();
+}
+
+SolutionGrid *Solver::solve(int level, const SolutionGrid *previous) const
+{
+    int n = points(level);
+    SolutionGrid *grid = new SolutionGrid(m_box, n, n, n);
+
+    bool refine = (previous && level > 0 && previous->nx() == points(level - 1));
+
+    const double *x = m_x.constData();
+    const double *y = m_y.constData();
+    const double *z = m_z.constData();
+    int count = m_x.size();
+    double softening2 = m_softening * m_softening;
+    double *values = grid->values();
+
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < n; k++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            // points of the previous level are taken over
+            bool coarseRow = refine && (j % 2 == 0) && (k % 2 == 0);
+
+            for (int i = 0; i < n; i++)
+            {
+                if (coarseRow && (i % 2 == 0))
+                {
+                    values[grid->index(i, j, k)] = previous->value(i / 2, j / 2, k / 2);
+                    continue;
+                }
+
+                Point3 point = grid->point(i, j, k);
+
+                double sum = 0.0;
+                for (int s = 0; s < count; s++)
+                {
+                    double dx = point.x - x[s];
+                    double dy = point.y - y[s];
+                    double dz = point.z - z[s];
+                    sum += 1.0 / sqrt(dx*dx + dy*dy + dz*dz + softening2);
+                }
+
+                values[grid->index(i, j, k)] = sum / (4.0 * M_PI);
+            }
+        }
+    }
+
+    return grid;
+}
@@ -0,0 +1,70 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef SOLVER_H
+#define SOLVER_H
+
+#include "util.h"
+
+class SolutionGrid;
+
+/// potential of unit point sources placed in the scene nodes, u(x) = sum 1 / (4 pi sqrt(|x - x_i|^2 + delta^2))
+/// the softening length delta keeps the field finite in the sources
+/// the grid of the level l has (coarse * 2^l + 1) points per axis, points of the level l - 1 are its even points
+/// and are taken over, so the refinement evaluates only the new points
+class Solver
+{
+public:
+    Solver(const QList<Point3> &sources, const CubePoint &box, int coarse);
+
+    inline CubePoint box() const { return m_box; }
+    inline int coarse() const { return m_coarse; }
+    inline double softening() const { return m_softening; }
+
+    inline int sourceCount() const { return m_x.size(); }
+    inline Point3 source(int i) const { return Point3(m_x[i], m_y[i], m_z[i]); }
+
+    /// number of grid points per axis on the level
+    inline int points(int level) const { return m_coarse * (1 << level) + 1; }
+
+    /// evaluates the level, the previous level (optional) has to be level - 1 of the same solver
+    SolutionGrid *solve(int level, const SolutionGrid *previous = NULL) const;
+
+    /// potential in the point
+    double value(const Point3 &point) const;
+
+    /// superposition: subtracts contributions of the removed sources and adds the added ones in all points of the grid,
+    /// the grid has to be in the box of the solver (same softening)
+    void update(SolutionGrid *grid, const QList<Point3> &removed, const QList<Point3> &added) const;
+
+    /// evaluation box around the sources
+    static CubePoint evaluationBox(const CubePoint &boundingBox);
+
+private:
+    CubePoint m_box;
+    int m_coarse;
+    double m_softening;
+
+    // sources (structure of arrays)
+    QVector<double> m_x;
+    QVector<double> m_y;
+    QVector<double> m_z;
+};
+
+#endif // SOLVER_H
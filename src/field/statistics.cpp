@@ -0,0 +1,445 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "statistics.h"
+#include "solutiongrid.h"
+#include "solutionstore.h"
+
+#include "util/constants.h"
+
+// partial reduction of one chunk
+struct StatisticsChunk
+{
+    int count;
+    double min;
+    double max;
+    double mean;
+    double m2;
+
+    StatisticsChunk() : count(0), min(0.0), max(0.0), mean(0.0), m2(0.0) {}
+
+    inline void operator()(double value)
+    {
+        if (value != value)
+            return;
+
+        if (count == 0)
+        {
+            min = value;
+            max = value;
+        }
+        else
+        {
+            if (value < min) min = value;
+            if (value > max) max = value;
+        }
+
+        count++;
+        double delta = value - mean;
+        mean += delta / count;
+        m2 += delta * (value - mean);
+    }
+};
+
+// bin of the value (copy of the histogram layout for the parallel visitors)
+struct StatisticsBin
+{
+    double low;
+    double width;
+    int bins;
+
+    inline int operator()(double value) const
+    {
+        return qBound(0, (int) floor((value - low) / width), bins - 1);
+    }
+};
+
+struct StatisticsBins
+{
+    StatisticsBin bin;
+    int *bins;
+
+    StatisticsBins(const StatisticsBin &bin, int *bins) : bin(bin), bins(bins) {}
+
+    inline void operator()(double value)
+    {
+        if (value == value)
+            bins[bin(value)]++;
+    }
+};
+
+// contiguous array split into chunks of STATISTICSCHUNK values
+struct StatisticsArrayChunks
+{
+    const double *values;
+    int size;
+
+    StatisticsArrayChunks(const double *values, int size) : values(values), size(size) {}
+
+    inline int count() const { return (size + STATISTICSCHUNK - 1) / STATISTICSCHUNK; }
+
+    template <typename Visitor>
+    inline void visit(int chunk, Visitor &visitor) const
+    {
+        int end = qMin(size, (chunk + 1) * STATISTICSCHUNK);
+        for (int i = chunk * STATISTICSCHUNK; i < end; i++)
+            visitor(values[i]);
+    }
+};
+
+// points of the refined grid which are not shared with the previous level (any odd index), chunk is a plane k
+struct StatisticsRefinementChunks
+{
+    const SolutionGrid *grid;
+
+    StatisticsRefinementChunks(const SolutionGrid *grid) : grid(grid) {}
+
+    inline int count() const { return grid->nz(); }
+
+    template <typename Visitor>
+    inline void visit(int k, Visitor &visitor) const
+    {
+        for (int j = 0; j < grid->ny(); j++)
+        {
+            const double *row = grid->values() + grid->index(0, j, k);
+
+            // rows with even j and k hold new values in odd i only
+            int step = ((j | k) & 1) ? 1 : 2;
+            for (int i = step - 1; i < grid->nx(); i += step)
+                visitor(row[i]);
+        }
+    }
+};
+
+Statistics::Statistics()
+{
+    clear();
+}
+
+void Statistics::clear()
+{
+    m_count = 0;
+    m_min = 0.0;
+    m_max = 0.0;
+    m_mean = 0.0;
+    m_m2 = 0.0;
+
+    m_low = 0.0;
+    m_width = 1.0;
+    m_bins.clear();
+}
+
+double Statistics::deviation() const
+{
+    return (m_count > 1) ? sqrt(m_m2 / (m_count - 1)) : 0.0;
+}
+
+void Statistics::addMoments(int count, double min, double max, double mean, double m2)
+{
+    if (count == 0)
+        return;
+
+    if (m_count == 0)
+    {
+        m_min = min;
+        m_max = max;
+    }
+    else
+    {
+        m_min = qMin(m_min, min);
+        m_max = qMax(m_max, max);
+    }
+
+    double total = (double) m_count + count;
+    double delta = mean - m_mean;
+    m_mean += delta * count / total;
+    m_m2 += m2 + delta * delta * m_count * count / total;
+    m_count += count;
+}
+
+void Statistics::cover(double min, double max)
+{
+    if (m_bins.isEmpty())
+    {
+        m_low = min;
+        m_width = (max - min) / STATISTICSBINS;
+        // constant values
+        if (m_width <= 0.0)
+            m_width = qMax(fabs(min), 1.0) * EPS_ZERO;
+
+        m_bins.fill(0, STATISTICSBINS);
+        return;
+    }
+
+    int half = STATISTICSBINS / 2;
+
+    while (min < m_low)
+    {
+        QVector<int> bins(STATISTICSBINS, 0);
+        for (int i = 0; i < STATISTICSBINS; i++)
+            bins[half + i / 2] += m_bins[i];
+
+        m_bins = bins;
+        m_low -= STATISTICSBINS * m_width;
+        m_width *= 2.0;
+    }
+
+    while (max > m_low + STATISTICSBINS * m_width)
+    {
+        QVector<int> bins(STATISTICSBINS, 0);
+        for (int i = 0; i < STATISTICSBINS; i++)
+            bins[i / 2] += m_bins[i];
+
+        m_bins = bins;
+        m_width *= 2.0;
+    }
+}
+
+template <typename Chunks>
+void Statistics::addChunks(const Chunks &chunks)
+{
+    int count = chunks.count();
+    if (count == 0)
+        return;
+
+    // moments and range
+    QVector<StatisticsChunk> partials(count);
+    StatisticsChunk *partialData = partials.data();
+
+#pragma omp parallel for schedule(dynamic)
+    for (int c = 0; c < count; c++)
+        chunks.visit(c, partialData[c]);
+
+    int added = 0;
+    double min = 0.0;
+    double max = 0.0;
+    for (int c = 0; c < count; c++)
+    {
+        const StatisticsChunk &partial = partials[c];
+        if (partial.count == 0)
+            continue;
+
+        min = (added == 0) ? partial.min : qMin(min, partial.min);
+        max = (added == 0) ? partial.max : qMax(max, partial.max);
+        added += partial.count;
+
+        addMoments(partial.count, partial.min, partial.max, partial.mean, partial.m2);
+    }
+
+    if (added == 0)
+        return;
+
+    // histogram, every chunk counts into its own bins
+    cover(min, max);
+
+    StatisticsBin bin;
+    bin.low = m_low;
+    bin.width = m_width;
+    bin.bins = STATISTICSBINS;
+
+    QVector<int> chunkBins(count * STATISTICSBINS, 0);
+    int *chunkBinsData = chunkBins.data();
+
+#pragma omp parallel for schedule(dynamic)
+    for (int c = 0; c < count; c++)
+    {
+        StatisticsBins visitor(bin, chunkBinsData + c * STATISTICSBINS);
+        chunks.visit(c, visitor);
+    }
+
+    for (int c = 0; c < count; c++)
+        for (int b = 0; b < STATISTICSBINS; b++)
+            m_bins[b] += chunkBins[c * STATISTICSBINS + b];
+}
+
+void Statistics::add(const double *values, int count)
+{
+    addChunks(StatisticsArrayChunks(values, count));
+}
+
+void Statistics::merge(const Statistics &other)
+{
+    if (other.isEmpty())
+        return;
+
+    addMoments(other.m_count, other.m_min, other.m_max, other.m_mean, other.m_m2);
+
+    // bins of the other statistics are counted in their centers
+    cover(other.m_min, other.m_max);
+    for (int i = 0; i < other.m_bins.size(); i++)
+        if (other.m_bins[i] > 0)
+        {
+            double center = other.m_low + (i + 0.5) * other.m_width;
+            m_bins[bin(qBound(other.m_min, center, other.m_max))] += other.m_bins[i];
+        }
+}
+
+double Statistics::percentile(double p) const
+{
+    if (m_count == 0)
+        return 0.0;
+
+    double target = qBound(0.0, p, 1.0) * m_count;
+
+    double cumulative = 0.0;
+    for (int i = 0; i < m_bins.size(); i++)
+    {
+        if (m_bins[i] > 0 && cumulative + m_bins[i] >= target)
+        {
+            double fraction = (target - cumulative) / m_bins[i];
+            return qBound(m_min, m_low + (i + fraction) * m_width, m_max);
+        }
+        cumulative += m_bins[i];
+    }
+
+    return m_max;
+}
+
+QVector<double> Statistics::histogram(int bins) const
+{
+    QVector<double> result(bins, 0.0);
+    if (m_count == 0 || bins < 1)
+        return result;
+
+    double range = m_max - m_min;
+    if (range <= 0.0)
+    {
+        result[0] = m_count;
+        return result;
+    }
+
+    // values are spread uniformly inside the bins, clipped to the range
+    for (int i = 0; i < m_bins.size(); i++)
+    {
+        if (m_bins[i] == 0)
+            continue;
+
+        double start = qMax(m_min, m_low + i * m_width);
+        double end = qMin(m_max, m_low + (i + 1) * m_width);
+        if (end <= start)
+        {
+            result[qBound(0, (int) ((start - m_min) / range * bins), bins - 1)] += m_bins[i];
+            continue;
+        }
+
+        double density = m_bins[i] / (end - start);
+        int first = qBound(0, (int) ((start - m_min) / range * bins), bins - 1);
+        int last = qBound(0, (int) ((end - m_min) / range * bins), bins - 1);
+        for (int b = first; b <= last; b++)
+        {
+            double binStart = m_min + b * range / bins;
+            double binEnd = m_min + (b + 1) * range / bins;
+            double overlap = qMin(end, binEnd) - qMax(start, binStart);
+            if (overlap > 0.0)
+                result[b] += density * overlap;
+        }
+    }
+
+    return result;
+}
+
+// *************************************************************************************************************************************
+
+SolutionStatistics::SolutionStatistics(const SolutionStore *store) : m_store(store)
+{
+}
+
+void SolutionStatistics::clear()
+{
+    m_cache.clear();
+}
+
+Statistics SolutionStatistics::statistics(StatisticsQuantity quantity, int step)
+{
+    if (m_store->isEmpty())
+        return Statistics();
+
+    if (step < 0 || step >= m_store->count())
+        step = m_store->count() - 1;
+
+    const SolutionGrid *grid = m_store->grid(step);
+    QPair<int, int> key(quantity, step);
+
+    QHash<QPair<int, int>, Entry>::const_iterator it = m_cache.constFind(key);
+    if (it != m_cache.constEnd() && it.value().revision == grid->revision())
+        return it.value().statistics;
+
+    Entry entry;
+    entry.revision = grid->revision();
+
+    if (quantity == StatisticsQuantity_Potential)
+    {
+        // previous level of the progressive solve
+        QPair<int, int> previousKey(quantity, step - 1);
+        QHash<QPair<int, int>, Entry>::const_iterator previous = m_cache.constFind(previousKey);
+
+        if (step > 0 && previous != m_cache.constEnd() &&
+                previous.value().revision == m_store->grid(step - 1)->revision() &&
+                isRefinement(grid, m_store->grid(step - 1)))
+        {
+            entry.statistics = previous.value().statistics;
+            addRefinement(entry.statistics, grid);
+        }
+        else
+        {
+            entry.statistics.add(grid->values(), grid->count());
+        }
+    }
+    else
+    {
+        addField(entry.statistics, grid);
+    }
+
+    m_cache.insert(key, entry);
+    return entry.statistics;
+}
+
+bool SolutionStatistics::isRefinement(const SolutionGrid *grid, const SolutionGrid *previous)
+{
+    // the solver copies values of the previous level into the even points of the refined grid
+    return (grid->nx() == 2 * previous->nx() - 1 &&
+            grid->ny() == 2 * previous->ny() - 1 &&
+            grid->nz() == 2 * previous->nz() - 1 &&
+            grid->box().start == previous->box().start &&
+            grid->box().end == previous->box().end);
+}
+
+void SolutionStatistics::addRefinement(Statistics &statistics, const SolutionGrid *grid)
+{
+    statistics.addChunks(StatisticsRefinementChunks(grid));
+}
+
+void SolutionStatistics::addField(Statistics &statistics, const SolutionGrid *grid)
+{
+    QVector<float> gradients;
+    grid->gradients(gradients);
+
+    QVector<double> magnitudes(grid->count());
+    const float *gradientData = gradients.constData();
+    double *magnitudeData = magnitudes.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < grid->count(); i++)
+    {
+        const float *gradient = gradientData + 3 * i;
+        magnitudeData[i] = sqrt(gradient[0]*gradient[0] + gradient[1]*gradient[1] + gradient[2]*gradient[2]);
+    }
+
+    statistics.add(magnitudeData, magnitudes.count());
+}
@@ -0,0 +1,118 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef STATISTICS_H
+#define STATISTICS_H
+
+#include "util.h"
+
+class SolutionGrid;
+class SolutionStore;
+
+enum StatisticsQuantity
+{
+    StatisticsQuantity_Potential,
+    StatisticsQuantity_Field
+};
+
+/// count, range, mean, deviation, percentiles and histogram of values added in batches
+/// every batch is reduced in parallel over chunks (partial moments are merged by the Chan formula),
+/// values are counted in a fixed number of bins which are widened by merging pairs when the range grows,
+/// so percentiles and histograms are exact up to the bin width
+class Statistics
+{
+public:
+    Statistics();
+
+    void clear();
+
+    /// adds the values (NaN is skipped)
+    void add(const double *values, int count);
+    /// adds all values of the other statistics (histogram merged at the resolution of the bins)
+    void merge(const Statistics &other);
+
+    inline int count() const { return m_count; }
+    inline bool isEmpty() const { return m_count == 0; }
+
+    inline double min() const { return m_min; }
+    inline double max() const { return m_max; }
+    inline double mean() const { return m_mean; }
+    double deviation() const;
+
+    /// value below which the fraction p (0 - 1) of the values lies
+    double percentile(double p) const;
+    /// number of values in bins spanning uniformly [min(), max()]
+    QVector<double> histogram(int bins) const;
+
+private:
+    int m_count;
+    double m_min;
+    double m_max;
+    double m_mean;
+    // sum of squared deviations from the mean
+    double m_m2;
+
+    // bin i holds values [m_low + i * m_width, m_low + (i + 1) * m_width)
+    double m_low;
+    double m_width;
+    QVector<int> m_bins;
+
+    void addMoments(int count, double min, double max, double mean, double m2);
+    void cover(double min, double max);
+
+    /// values are visited per chunk (Chunks::count(), Chunks::visit(chunk, visitor))
+    template <typename Chunks>
+    void addChunks(const Chunks &chunks);
+
+    friend class SolutionStatistics;
+    inline int bin(double value) const
+    {
+        return qBound(0, (int) floor((value - m_low) / m_width), m_bins.size() - 1);
+    }
+};
+
+/// statistics of the solution quantities cached per (quantity, step of the store)
+/// statistics of the potential on a refined level are not computed from scratch: values shared with
+/// the cached previous level (even points of the refined grid) are taken over, only the new points are added
+class SolutionStatistics
+{
+public:
+    SolutionStatistics(const SolutionStore *store);
+
+    /// statistics of the quantity in the step (the last step by default), empty without solution
+    Statistics statistics(StatisticsQuantity quantity, int step = -1);
+
+    void clear();
+
+private:
+    struct Entry
+    {
+        int revision;
+        Statistics statistics;
+    };
+
+    const SolutionStore *m_store;
+    QHash<QPair<int, int>, Entry> m_cache;
+
+    static bool isRefinement(const SolutionGrid *grid, const SolutionGrid *previous);
+    static void addRefinement(Statistics &statistics, const SolutionGrid *grid);
+    static void addField(Statistics &statistics, const SolutionGrid *grid);
+};
+
+#endif // STATISTICS_H
@@ -23,6 +23,7 @@
 #include "util.h"
 
 #include "field/problem.h"
+#include "util/datatablewriter.h"
 
 #include <qwt_scale_map.h>
 #include <qwt_symbol.h>
@@ -37,6 +38,201 @@
 #include "qwt_plot_magnifier.h"
 #include "qwt_plot_rescaler.h"
 
+ChartSeriesData::ChartSeriesData()
+    : m_xMin(0.0), m_xMax(0.0), m_yMin(0.0), m_yMax(0.0), m_sorted(true),
+      m_resolution(1024), m_decimatedValid(false), m_decimatedUsed(false),
+      m_first(0), m_visibleCount(0)
+{
+}
+
+void ChartSeriesData::clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_xMin = m_xMax = m_yMin = m_yMax = 0.0;
+    m_sorted = true;
+
+    m_decimated.clear();
+    m_decimatedValid = false;
+}
+
+void ChartSeriesData::setSamples(const double *xval, const double *yval, int count)
+{
+    clear();
+    append(xval, yval, count);
+}
+
+void ChartSeriesData::append(const double *xval, const double *yval, int count)
+{
+    if (count <= 0)
+        return;
+
+    int previous = m_x.size();
+    m_x.resize(previous + count);
+    m_y.resize(previous + count);
+    memcpy(m_x.data() + previous, xval, count * sizeof(double));
+    memcpy(m_y.data() + previous, yval, count * sizeof(double));
+
+    if (previous == 0)
+    {
+        m_xMin = m_xMax = xval[0];
+        m_yMin = m_yMax = yval[0];
+    }
+
+    const double *x = m_x.constData();
+    const double *y = m_y.constData();
+    for (int i = previous; i < previous + count; i++)
+    {
+        m_xMin = qMin(m_xMin, x[i]);
+        m_xMax = qMax(m_xMax, x[i]);
+        m_yMin = qMin(m_yMin, y[i]);
+        m_yMax = qMax(m_yMax, y[i]);
+
+        if (i > 0 && x[i] < x[i - 1])
+            m_sorted = false;
+    }
+
+    // samples appended behind the visible part (and behind the sample closing it) do not change the decimation
+    if (m_decimatedValid)
+    {
+        if (!m_sorted || !m_rectOfInterest.isValid() || previous == 0 || x[previous - 1] <= m_rectOfInterest.right())
+            m_decimatedValid = false;
+    }
+}
+
+void ChartSeriesData::setResolution(int resolution)
+{
+    resolution = qMax(1, resolution);
+    if (resolution != m_resolution)
+    {
+        m_resolution = resolution;
+        m_decimatedValid = false;
+    }
+}
+
+void ChartSeriesData::setRectOfInterest(const QRectF &rect)
+{
+    if (rect != m_rectOfInterest)
+    {
+        m_rectOfInterest = rect;
+        m_decimatedValid = false;
+    }
+}
+
+QRectF ChartSeriesData::boundingRect() const
+{
+    if (m_x.isEmpty())
+        return QRectF(1.0, 1.0, -2.0, -2.0);
+
+    return QRectF(m_xMin, m_yMin, m_xMax - m_xMin, m_yMax - m_yMin);
+}
+
+size_t ChartSeriesData::size() const
+{
+    if (m_x.isEmpty())
+        return 0;
+
+    if (!m_decimatedValid)
+        decimate();
+
+    return m_decimatedUsed ? m_decimated.size() : m_visibleCount;
+}
+
+QPointF ChartSeriesData::sample(size_t i) const
+{
+    if (!m_decimatedValid)
+        decimate();
+
+    if (m_decimatedUsed)
+        return m_decimated[i];
+
+    return QPointF(m_x[m_first + i], m_y[m_first + i]);
+}
+
+void ChartSeriesData::visibleRange(int &first, int &last) const
+{
+    first = 0;
+    last = m_x.size() - 1;
+
+    if (!m_sorted || !m_rectOfInterest.isValid())
+        return;
+
+    // one sample on both sides to keep the lines leaving the canvas
+    const double *begin = m_x.constData();
+    const double *end = begin + m_x.size();
+    first = qMax(0, (int) (qLowerBound(begin, end, m_rectOfInterest.left()) - begin) - 1);
+    last = qMin(m_x.size() - 1, (int) (qUpperBound(begin, end, m_rectOfInterest.right()) - begin));
+}
+
+void ChartSeriesData::decimate() const
+{
+    int first, last;
+    visibleRange(first, last);
+
+    m_first = first;
+    m_visibleCount = last - first + 1;
+    m_decimated.clear();
+    m_decimatedValid = true;
+
+    // every column keeps at most four samples
+    m_decimatedUsed = (m_visibleCount > 4 * m_resolution);
+    if (!m_decimatedUsed)
+        return;
+
+    const double *x = m_x.constData();
+    const double *y = m_y.constData();
+
+    // columns by x for sorted samples, by index otherwise (also for a degenerate rect of interest)
+    double left = m_rectOfInterest.left();
+    double width = m_rectOfInterest.width() / m_resolution;
+    bool byX = m_sorted && m_rectOfInterest.isValid() && width > 0.0;
+
+    m_decimated.reserve(4 * (m_resolution + 2));
+
+    int column = 0;
+    int firstIndex = first, minIndex = first, maxIndex = first, lastIndex = first;
+    for (int i = first; i <= last + 1; i++)
+    {
+        int current = 0;
+        if (i <= last)
+        {
+            if (byX)
+                current = qBound(-1, (int) floor((x[i] - left) / width), m_resolution);
+            else
+                current = (int) ((qint64) (i - first) * m_resolution / m_visibleCount);
+        }
+
+        if (i == first)
+        {
+            column = current;
+            continue;
+        }
+
+        if (i > last || current != column)
+        {
+            // flush the column in the order of samples
+            int indices[4] = { firstIndex, qMin(minIndex, maxIndex), qMax(minIndex, maxIndex), lastIndex };
+            for (int j = 0; j < 4; j++)
+                if (j == 0 || indices[j] != indices[j - 1])
+                    m_decimated.append(QPointF(x[indices[j]], y[indices[j]]));
+
+            if (i > last)
+                break;
+
+            column = current;
+            firstIndex = minIndex = maxIndex = lastIndex = i;
+        }
+        else
+        {
+            if (y[i] < y[minIndex]) minIndex = i;
+            if (y[i] > y[maxIndex]) maxIndex = i;
+            lastIndex = i;
+        }
+    }
+}
+
+// **************************************************************************************************
+
 Chart::Chart(QWidget *parent, bool showPicker) : QwtPlot(parent)
 {
     //  chart style
@@ -104,6 +300,10 @@ Chart::Chart(QWidget *parent, bool showPicker) : QwtPlot(parent)
     m_curve->setYAxis(QwtPlot::yLeft);
     m_curve->attach(this);
 
+    // samples (owned by the curve)
+    m_series = new ChartSeriesData();
+    m_curve->setData(m_series);
+
 
     // chart picker
     QwtPlotPicker *pickerValue = new QwtPlotPicker(QwtPlot::xBottom, QwtPlot::yLeft,
@@ -116,6 +316,20 @@ Chart::Chart(QWidget *parent, bool showPicker) : QwtPlot(parent)
 
     connect(pickerValue, SIGNAL(moved(const QPoint &)), SLOT(pickerValueMoved(const QPoint &)));
 
+    // context menu
+    actSaveImage = new QAction(icon(""), tr("Export image..."), this);
+    connect(actSaveImage, SIGNAL(triggered()), this, SLOT(doSaveImage()));
+
+    actExportData = new QAction(icon(""), tr("Export data..."), this);
+    connect(actExportData, SIGNAL(triggered()), this, SLOT(doExportData()));
+
+    mnuContext = new QMenu(this);
+    mnuContext->addAction(actSaveImage);
+    mnuContext->addAction(actExportData);
+
+    setContextMenuPolicy(Qt::CustomContextMenu);
+    connect(this, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(doContextMenu(const QPoint &)));
+
     setMinimumSize(sizeHint());
 }
 
@@ -180,37 +394,88 @@ void Chart::saveImage(const QString &fileName)
     }
 }
 
-void Chart::setData(double *xval, double *yval, int count)
+void Chart::exportData(const QString &fileName)
 {
-    const bool doReplot = autoReplot();
-    setAutoReplot(false);
+    QSettings settings;
+    QString dir = settings.value("General/LastDataDir").toString();
+
+    QString fileNameTemp = fileName;
+    DataTableFormat format = DataTableFormat_CSV;
+    if (fileNameTemp.isEmpty())
+    {
+        QList<DataTableFormat> formats;
+        formats << DataTableFormat_CSV << DataTableFormat_Matlab << DataTableFormat_Binary << DataTableFormat_NPY;
+
+        QStringList filter;
+        foreach (DataTableFormat item, formats)
+            filter += DataTableWriter::filter(item);
+
+        QString selectedFilter;
+        fileNameTemp = QFileDialog::getSaveFileName(this, tr("Export data to file"), dir, filter.join(";;"), &selectedFilter);
+        if (fileNameTemp.isEmpty())
+            return;
+
+        // format of the selected filter, the suffix decides only without a filter
+        if (filter.contains(selectedFilter))
+            format = formats[filter.indexOf(selectedFilter)];
+        else
+            format = DataTableWriter::formatFromSuffix(QFileInfo(fileNameTemp).suffix());
+        if (QFileInfo(fileNameTemp).suffix().isEmpty())
+            fileNameTemp += "." + DataTableWriter::suffix(format);
+
+        QFileInfo fileInfo(fileNameTemp);
+        if (fileInfo.absoluteDir() != tempProblemDir())
+            settings.setValue("General/LastDataDir", fileInfo.absolutePath());
+    }
+    else
+    {
+        format = DataTableWriter::formatFromSuffix(QFileInfo(fileNameTemp).suffix());
+    }
 
-    m_curve->setSamples(xval, yval, count);
+    // full resolution samples
+    DataTableWriter writer(format);
+    writer.addColumn("x", m_series->xData().constData());
+    writer.addColumn("y", m_series->yData().constData());
 
-    setAutoReplot(doReplot);
+    if (!writer.write(fileNameTemp, m_series->count()))
+        ErrorResult(ErrorResultType_Critical, tr("File '%1' cannot be written (%2).").
+                    arg(fileNameTemp).arg(writer.errorString())).showDialog();
+}
+
+void Chart::setData(double *xval, double *yval, int count)
+{
+    m_series->setSamples(xval, yval, count);
 
     replot();
 }
 
 void Chart::setData(QList<double> xval, QList<double> yval)
 {
-    double *txval = new double[xval.count()];
-    double *tyval = new double[xval.count()];
+    QVector<double> x = xval.toVector();
+    QVector<double> y = yval.toVector();
 
-    for (int i = 0; i < xval.count(); i++)
-    {
-        txval[i] = xval[i];
-        tyval[i] = yval[i];
-    }
-
-    setData(txval, tyval, xval.count());
+    setData(x.data(), y.data(), qMin(x.size(), y.size()));
+}
 
-    delete [] txval;
-    delete [] tyval;
+void Chart::appendData(double *xval, double *yval, int count)
+{
+    m_series->append(xval, yval, count);
 
     replot();
 }
 
+void Chart::appendData(double xval, double yval)
+{
+    appendData(&xval, &yval, 1);
+}
+
+void Chart::resizeEvent(QResizeEvent *event)
+{
+    QwtPlot::resizeEvent(event);
+
+    m_series->setResolution(canvas()->width());
+}
+
 void Chart::pickerValueMoved(const QPoint &pos)
 {
     QString info;
@@ -218,3 +483,20 @@ void Chart::pickerValueMoved(const QPoint &pos)
                  invTransform(QwtPlot::xBottom, pos.x()),
                  invTransform(QwtPlot::yLeft, pos.y()));
 }
+
+void Chart::doContextMenu(const QPoint &pos)
+{
+    actExportData->setEnabled(m_series->count() > 0);
+
+    mnuContext->exec(mapToGlobal(pos));
+}
+
+void Chart::doSaveImage()
+{
+    saveImage();
+}
+
+void Chart::doExportData()
+{
+    exportData();
+}
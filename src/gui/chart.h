@@ -23,9 +23,56 @@
 #include <qwt_plot.h>
 #include <qwt_plot_curve.h>
 #include <qwt_plot_zoomer.h>
+#include <qwt_series_data.h>
 
 #include "util.h"
 
+/// full resolution samples in contiguous buffers, the curve is drawn from a min/max decimation of the visible part
+/// (first, minimum, maximum and last sample of every pixel column), the decimation is rebuilt only when the rect
+/// of interest, the resolution or the visible samples change
+class ChartSeriesData : public QwtSeriesData<QPointF>
+{
+public:
+    ChartSeriesData();
+
+    void setSamples(const double *xval, const double *yval, int count);
+    void append(const double *xval, const double *yval, int count);
+    void clear();
+
+    inline int count() const { return m_x.size(); }
+    inline const QVector<double> &xData() const { return m_x; }
+    inline const QVector<double> &yData() const { return m_y; }
+
+    /// number of pixel columns of the canvas
+    inline int resolution() const { return m_resolution; }
+    void setResolution(int resolution);
+
+    // QwtSeriesData
+    size_t size() const;
+    QPointF sample(size_t i) const;
+    QRectF boundingRect() const;
+    void setRectOfInterest(const QRectF &rect);
+
+private:
+    QVector<double> m_x;
+    QVector<double> m_y;
+    double m_xMin, m_xMax, m_yMin, m_yMax;
+    // x is non decreasing, visible samples are found by bisection
+    bool m_sorted;
+
+    int m_resolution;
+    QRectF m_rectOfInterest;
+
+    mutable QVector<QPointF> m_decimated;
+    mutable bool m_decimatedValid;
+    mutable bool m_decimatedUsed;
+    mutable int m_first;
+    mutable int m_visibleCount;
+
+    void visibleRange(int &first, int &last) const;
+    void decimate() const;
+};
+
 class Chart : public QwtPlot
 {
     Q_OBJECT
@@ -34,18 +81,32 @@ public:
     ~Chart();
 
     inline QwtPlotCurve *curve() { return m_curve; }
+    inline ChartSeriesData *series() { return m_series; }
     void saveImage(const QString &fileName = "");
+    void exportData(const QString &fileName = "");
 
 public slots:
    void setData(double *xval, double *yval, int count);
    void setData(QList<double> xval, QList<double> yval);
+   void appendData(double *xval, double *yval, int count);
+   void appendData(double xval, double yval);
+
+protected:
+    void resizeEvent(QResizeEvent *event);
 
 private:
     QwtPlotCurve *m_curve;
+    ChartSeriesData *m_series;
 
+    QAction *actSaveImage;
+    QAction *actExportData;
+    QMenu *mnuContext;
 
 private slots:
     void pickerValueMoved(const QPoint &pos);
+    void doContextMenu(const QPoint &pos);
+    void doSaveImage();
+    void doExportData();
 };
 
 #endif // GUI_CHART_H
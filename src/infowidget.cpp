@@ -31,6 +31,9 @@
 
 #include "ctemplate/template.h"
 
+#include "problem.tpl.varnames.h"
+#include "problem_style.tpl.varnames.h"
+
 InfoWidget::InfoWidget(SceneViewPreprocessor *sceneView, QWidget *parent): QWidget(parent)
 {
     this->m_sceneViewGeometry = sceneView;
@@ -66,51 +69,62 @@ void InfoWidget::refresh()
     QTimer::singleShot(0, this, SLOT(showInfo()));
 }
 
-void InfoWidget::showInfo()
+const std::string &InfoWidget::styleSheet()
 {
-    // stylesheet
-    std::string style;
-    ctemplate::TemplateDictionary stylesheet("style");
-    stylesheet.SetValue("FONTFAMILY", QApplication::font().family().toStdString());
-    stylesheet.SetValue("FONTSIZE", (QString("%1").arg(QApplication::font().pointSize() - 1).toStdString()));
+    // expanded again only when the font changes
+    QString font = QString("%1 %2").arg(QApplication::font().family()).arg(QApplication::font().pointSize());
+    if (font != m_styleSheetFont)
+    {
+        ctemplate::TemplateDictionary stylesheet("style");
+        stylesheet.SetValue(kps_FONTFAMILY, QApplication::font().family().toStdString());
+        stylesheet.SetValue(kps_FONTSIZE, (QString("%1").arg(QApplication::font().pointSize() - 1).toStdString()));
 
-    ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/problem_style.tpl", ctemplate::DO_NOT_STRIP, &stylesheet, &style);
+        m_styleSheet.clear();
+        ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/problem_style.tpl", ctemplate::DO_NOT_STRIP, &stylesheet, &m_styleSheet);
+        m_styleSheetFont = font;
+    }
 
+    return m_styleSheet;
+}
+
+void InfoWidget::showInfo()
+{
     // template
     std::string info;
     ctemplate::TemplateDictionary problemInfo("info");
 
-    problemInfo.SetValue("STYLESHEET", style);
-    problemInfo.SetValue("BASIC_INFORMATION_LABEL", tr("Basic informations").toStdString());
+    problemInfo.SetValue(kp_STYLESHEET, styleSheet());
+    problemInfo.SetValue(kp_BASIC_INFORMATION_LABEL, tr("Basic informations").toStdString());
 
-    problemInfo.SetValue("NAME_LABEL", tr("Name:").toStdString());
-    problemInfo.SetValue("NAME", Util::problem()->config()->name().toStdString());
+    problemInfo.SetValue(kp_NAME_LABEL, tr("Name:").toStdString());
+    problemInfo.SetValue(kp_NAME, Util::problem()->config()->name().toStdString());
 
-    problemInfo.SetValue("GEOMETRY_LABEL", tr("Geometry").toStdString());
-    problemInfo.SetValue("GEOMETRY_NODES_LABEL", tr("Nodes:").toStdString());
-    problemInfo.SetValue("GEOMETRY_NODES", QString::number(Util::scene()->nodes->count()).toStdString());
+    problemInfo.SetValue(kp_GEOMETRY_LABEL, tr("Geometry").toStdString());
+    problemInfo.SetValue(kp_GEOMETRY_NODES_LABEL, tr("Nodes:").toStdString());
+    problemInfo.SetValue(kp_GEOMETRY_NODES, QString::number(Util::scene()->nodes->count()).toStdString());
 
     if (Util::problem()->isSolved())
     {
-        problemInfo.SetValue("SOLUTION_LABEL", tr("Solution").toStdString());
-        problemInfo.SetValue("SOLUTION_ELAPSED_TIME_LABEL", tr("Total elapsed time:").toStdString());
-        // problemInfo.SetValue("SOLUTION_ELAPSED_TIME", tr("%1 s").arg(Util::problem()->timeElapsed().toString("mm:ss.zzz")).toStdString());
-        problemInfo.SetValue("NUM_THREADS_LABEL", tr("Number of threads:").toStdString());
-        // problemInfo.SetValue("NUM_THREADS", tr("%1").arg(Hermes::Hermes2D::Hermes2DApi.get_param_value(Hermes::Hermes2D::numThreads)).toStdString());
-        problemInfo.ShowSection("SOLUTION_PARAMETERS_SECTION");
+        problemInfo.SetValue(kp_SOLUTION_LABEL, tr("Solution").toStdString());
+        problemInfo.SetValue(kp_SOLUTION_ELAPSED_TIME_LABEL, tr("Total elapsed time:").toStdString());
+        // problemInfo.SetValue(kp_SOLUTION_ELAPSED_TIME, tr("%1 s").arg(Util::problem()->timeElapsed().toString("mm:ss.zzz")).toStdString());
+        problemInfo.SetValue(kp_NUM_THREADS_LABEL, tr("Number of threads:").toStdString());
+        // problemInfo.SetValue(kp_NUM_THREADS, tr("%1").arg(Hermes::Hermes2D::Hermes2DApi.get_param_value(Hermes::Hermes2D::numThreads)).toStdString());
+        problemInfo.ShowSection(kp_SOLUTION_PARAMETERS_SECTION);
     }
 
     ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/problem.tpl", ctemplate::DO_NOT_STRIP, &problemInfo, &info);
 
-    // setHtml(...) doesn't work
-    // webView->setHtml(QString::fromStdString(info));
+    // unchanged page is not reloaded
+    QString html = QString::fromStdString(info);
+    if (html == m_html)
+        return;
+    m_html = html;
 
-    // load(...) works
-    writeStringContent(tempProblemDir() + "/info.html", QString::fromStdString(info));
-    webView->load(tempProblemDir() + "/info.html");
+    // loaded from memory, relative paths are resolved in the temp dir as before
+    webView->setHtml(html, QUrl::fromLocalFile(tempProblemDir() + "/info.html"));
 }
 
-
 void InfoWidget::finishLoading(bool ok)
 {
     // adaptive error
@@ -43,6 +43,14 @@ private:
 
     QWebView *webView;
 
+    // expanded stylesheet and the font it belongs to
+    std::string m_styleSheet;
+    QString m_styleSheetFont;
+    // shown page
+    QString m_html;
+
+    const std::string &styleSheet();
+
 private slots:
     void showInfo();
 
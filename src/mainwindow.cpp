@@ -41,6 +41,7 @@
 #include "problemdialog.h"
 #include "resultsview.h"
 #include "scenetransformdialog.h"
+#include "field/solutionstore.h"
 
 #include "gl2ps/gl2ps.h"
 
@@ -84,6 +85,8 @@ MainWindow::MainWindow(QWidget *parent) : QMainWindow(parent)
 
     connect(Util::problem(), SIGNAL(meshed()), this, SLOT(setControls()));
     connect(Util::problem(), SIGNAL(solved()), this, SLOT(setControls()));
+    connect(Util::problem(), SIGNAL(solutionRefined(int)), this, SLOT(doSolutionRefined(int)));
+    connect(Util::problem(), SIGNAL(solvingChanged(bool)), this, SLOT(setControls()));
 
     connect(tabViewLayout, SIGNAL(currentChanged(int)), this, SLOT(setControls()));
     connect(Util::scene(), SIGNAL(invalidated()), this, SLOT(setControls()));
@@ -389,6 +392,7 @@ void MainWindow::createMenus()
     mnuEdit->addSeparator();
     mnuEdit->addAction(sceneViewPreprocessor->actSceneViewSelectRegion);
     mnuEdit->addAction(Util::scene()->actTransform);
+    mnuEdit->addAction(Util::scene()->actMergeDuplicates);
 #ifdef Q_WS_X11
     mnuEdit->addSeparator();
     mnuEdit->addAction(actOptions);
@@ -957,7 +961,9 @@ void MainWindow::doSolve()
     Util::problem()->solve();
     if (Util::problem()->isSolved())
     {
-        sceneViewPost3D->actSceneModePost3D->trigger();
+        // the view was switched by the preview of the first level of the progressive solve
+        if (Util::problem()->solutionStore()->count() == 1)
+            sceneViewPost3D->actSceneModePost3D->trigger();
 
         // show local point values
         Point point = Point(0, 0);
@@ -1147,6 +1153,7 @@ void MainWindow::setControls()
         tabControlsLayout->setCurrentWidget(settingsWidget);
     }
 
+    actSolve->setEnabled(!Util::problem()->isSolving());
     actChart->setEnabled(Util::problem()->isSolved());
 
     QTimer::singleShot(0, postprocessorWidget, SLOT(updateControls()));
@@ -1158,6 +1165,16 @@ void MainWindow::setControls()
     //actApplicationLog->setEnabled(Util::config()->enabledApplicationLog);
 }
 
+void MainWindow::doSolutionRefined(int level)
+{
+    // preview of the coarse solution is shown once, the post view redraws itself on the finer levels
+    // (the preprocessor stays if the user returns to it while solving)
+    if (level == 0 && !sceneViewPost3D->actSceneModePost3D->isChecked())
+        sceneViewPost3D->actSceneModePost3D->trigger();
+
+    setControls();
+}
+
 void MainWindow::doPostprocessorModeGroupChanged(SceneModePostprocessor sceneModePostprocessor)
 {
     //resultsView->raise();
@@ -71,6 +71,7 @@ private slots:
     void doMouseSceneModeChanged(MouseSceneMode mouseSceneMode);
 
     void doSolve();
+    void doSolutionRefined(int level);
 
     void doChart();
     void doScriptEditor();
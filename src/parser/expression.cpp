@@ -0,0 +1,565 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "expression.h"
+#include "lex.h"
+
+#include "util/constants.h"
+
+enum ExpressionOperation
+{
+    ExpressionOperation_Constant,
+    ExpressionOperation_Variable,
+    ExpressionOperation_Negate,
+    // power of constant exponent 2
+    ExpressionOperation_Square,
+    ExpressionOperation_Add,
+    ExpressionOperation_Subtract,
+    ExpressionOperation_Multiply,
+    ExpressionOperation_Divide,
+    ExpressionOperation_Power,
+    ExpressionOperation_Less,
+    ExpressionOperation_Greater,
+    ExpressionOperation_LessEqual,
+    ExpressionOperation_GreaterEqual,
+    ExpressionOperation_Equal,
+    ExpressionOperation_NotEqual,
+    ExpressionOperation_And,
+    ExpressionOperation_Or,
+    ExpressionOperation_Function,
+    // markers of the operator stack, never emitted
+    ExpressionOperation_Parenthesis
+};
+
+enum ExpressionFunction
+{
+    ExpressionFunction_Sin,
+    ExpressionFunction_Cos,
+    ExpressionFunction_Tan,
+    ExpressionFunction_Asin,
+    ExpressionFunction_Acos,
+    ExpressionFunction_Atan,
+    ExpressionFunction_Sinh,
+    ExpressionFunction_Cosh,
+    ExpressionFunction_Tanh,
+    ExpressionFunction_Exp,
+    ExpressionFunction_Log,
+    ExpressionFunction_Log10,
+    ExpressionFunction_Sqrt,
+    ExpressionFunction_Abs,
+    ExpressionFunction_Sign,
+    ExpressionFunction_Pow,
+    ExpressionFunction_Atan2,
+    ExpressionFunction_Min,
+    ExpressionFunction_Max
+};
+
+struct ExpressionFunctionInfo
+{
+    const char *name;
+    int arguments;
+};
+
+// in the order of ExpressionFunction
+static const ExpressionFunctionInfo expressionFunctions[] = {
+    { "sin", 1 }, { "cos", 1 }, { "tan", 1 }, { "asin", 1 }, { "acos", 1 }, { "atan", 1 },
+    { "sinh", 1 }, { "cosh", 1 }, { "tanh", 1 }, { "exp", 1 }, { "log", 1 }, { "log10", 1 },
+    { "sqrt", 1 }, { "abs", 1 }, { "sign", 1 },
+    { "pow", 2 }, { "atan2", 2 }, { "min", 2 }, { "max", 2 }
+};
+static const int expressionFunctionCount = sizeof(expressionFunctions) / sizeof(ExpressionFunctionInfo);
+
+static inline double sign(double value) { return (value > 0.0) ? 1.0 : ((value < 0.0) ? -1.0 : 0.0); }
+static inline double minimum(double a, double b) { return (a < b) ? a : b; }
+static inline double maximum(double a, double b) { return (a > b) ? a : b; }
+
+// element-wise kernels, the function is a template argument so that it is inlined in the loop
+template <double (*function)(double)>
+static inline void kernel(double *a, int count)
+{
+    for (int i = 0; i < count; i++)
+        a[i] = function(a[i]);
+}
+
+template <double (*function)(double, double)>
+static inline void kernel(double *a, const double *b, int count)
+{
+    for (int i = 0; i < count; i++)
+        a[i] = function(a[i], b[i]);
+}
+
+static inline double operationAdd(double a, double b) { return a + b; }
+static inline double operationSubtract(double a, double b) { return a - b; }
+static inline double operationMultiply(double a, double b) { return a * b; }
+static inline double operationDivide(double a, double b) { return a / b; }
+static inline double operationLess(double a, double b) { return (a < b) ? 1.0 : 0.0; }
+static inline double operationGreater(double a, double b) { return (a > b) ? 1.0 : 0.0; }
+static inline double operationLessEqual(double a, double b) { return (a <= b) ? 1.0 : 0.0; }
+static inline double operationGreaterEqual(double a, double b) { return (a >= b) ? 1.0 : 0.0; }
+static inline double operationEqual(double a, double b) { return (a == b) ? 1.0 : 0.0; }
+static inline double operationNotEqual(double a, double b) { return (a != b) ? 1.0 : 0.0; }
+static inline double operationAnd(double a, double b) { return (a != 0.0 && b != 0.0) ? 1.0 : 0.0; }
+static inline double operationOr(double a, double b) { return (a != 0.0 || b != 0.0) ? 1.0 : 0.0; }
+static inline double operationNegate(double a) { return -a; }
+static inline double operationSquare(double a) { return a * a; }
+
+// unary operation or function on the top of the stack
+static void applyUnary(int operation, int index, double *a, int count)
+{
+    if (operation == ExpressionOperation_Negate)
+    {
+        kernel<operationNegate>(a, count);
+        return;
+    }
+    if (operation == ExpressionOperation_Square)
+    {
+        kernel<operationSquare>(a, count);
+        return;
+    }
+
+    switch (index)
+    {
+    case ExpressionFunction_Sin: kernel<sin>(a, count); break;
+    case ExpressionFunction_Cos: kernel<cos>(a, count); break;
+    case ExpressionFunction_Tan: kernel<tan>(a, count); break;
+    case ExpressionFunction_Asin: kernel<asin>(a, count); break;
+    case ExpressionFunction_Acos: kernel<acos>(a, count); break;
+    case ExpressionFunction_Atan: kernel<atan>(a, count); break;
+    case ExpressionFunction_Sinh: kernel<sinh>(a, count); break;
+    case ExpressionFunction_Cosh: kernel<cosh>(a, count); break;
+    case ExpressionFunction_Tanh: kernel<tanh>(a, count); break;
+    case ExpressionFunction_Exp: kernel<exp>(a, count); break;
+    case ExpressionFunction_Log: kernel<log>(a, count); break;
+    case ExpressionFunction_Log10: kernel<log10>(a, count); break;
+    case ExpressionFunction_Sqrt: kernel<sqrt>(a, count); break;
+    case ExpressionFunction_Abs: kernel<fabs>(a, count); break;
+    case ExpressionFunction_Sign: kernel<sign>(a, count); break;
+    default: assert(0);
+    }
+}
+
+// binary operation or function on the two topmost values of the stack, result replaces a
+static void applyBinary(int operation, int index, double *a, const double *b, int count)
+{
+    switch (operation)
+    {
+    case ExpressionOperation_Add: kernel<operationAdd>(a, b, count); break;
+    case ExpressionOperation_Subtract: kernel<operationSubtract>(a, b, count); break;
+    case ExpressionOperation_Multiply: kernel<operationMultiply>(a, b, count); break;
+    case ExpressionOperation_Divide: kernel<operationDivide>(a, b, count); break;
+    case ExpressionOperation_Power: kernel<pow>(a, b, count); break;
+    case ExpressionOperation_Less: kernel<operationLess>(a, b, count); break;
+    case ExpressionOperation_Greater: kernel<operationGreater>(a, b, count); break;
+    case ExpressionOperation_LessEqual: kernel<operationLessEqual>(a, b, count); break;
+    case ExpressionOperation_GreaterEqual: kernel<operationGreaterEqual>(a, b, count); break;
+    case ExpressionOperation_Equal: kernel<operationEqual>(a, b, count); break;
+    case ExpressionOperation_NotEqual: kernel<operationNotEqual>(a, b, count); break;
+    case ExpressionOperation_And: kernel<operationAnd>(a, b, count); break;
+    case ExpressionOperation_Or: kernel<operationOr>(a, b, count); break;
+    case ExpressionOperation_Function:
+        switch (index)
+        {
+        case ExpressionFunction_Pow: kernel<pow>(a, b, count); break;
+        case ExpressionFunction_Atan2: kernel<atan2>(a, b, count); break;
+        case ExpressionFunction_Min: kernel<minimum>(a, b, count); break;
+        case ExpressionFunction_Max: kernel<maximum>(a, b, count); break;
+        default: assert(0);
+        }
+        break;
+    default: assert(0);
+    }
+}
+
+static inline int operandCount(int operation, int index)
+{
+    if (operation == ExpressionOperation_Constant || operation == ExpressionOperation_Variable)
+        return 0;
+    if (operation == ExpressionOperation_Negate || operation == ExpressionOperation_Square)
+        return 1;
+    if (operation == ExpressionOperation_Function)
+        return expressionFunctions[index].arguments;
+    return 2;
+}
+
+// binding strength of the operators, power is right associative
+static int precedence(int operation)
+{
+    switch (operation)
+    {
+    case ExpressionOperation_Or: return 1;
+    case ExpressionOperation_And: return 2;
+    case ExpressionOperation_Equal:
+    case ExpressionOperation_NotEqual: return 3;
+    case ExpressionOperation_Less:
+    case ExpressionOperation_Greater:
+    case ExpressionOperation_LessEqual:
+    case ExpressionOperation_GreaterEqual: return 4;
+    case ExpressionOperation_Add:
+    case ExpressionOperation_Subtract: return 5;
+    case ExpressionOperation_Multiply:
+    case ExpressionOperation_Divide: return 6;
+    case ExpressionOperation_Negate: return 7;
+    case ExpressionOperation_Power: return 8;
+    default: return 0;
+    }
+}
+
+static int binaryOperation(const QString &text)
+{
+    if (text == "+") return ExpressionOperation_Add;
+    if (text == "-") return ExpressionOperation_Subtract;
+    if (text == "*") return ExpressionOperation_Multiply;
+    if (text == "/") return ExpressionOperation_Divide;
+    if (text == "^" || text == "**") return ExpressionOperation_Power;
+    if (text == "<") return ExpressionOperation_Less;
+    if (text == ">") return ExpressionOperation_Greater;
+    if (text == "<=") return ExpressionOperation_LessEqual;
+    if (text == ">=") return ExpressionOperation_GreaterEqual;
+    if (text == "==") return ExpressionOperation_Equal;
+    if (text == "!=") return ExpressionOperation_NotEqual;
+    if (text == "&&") return ExpressionOperation_And;
+    if (text == "||") return ExpressionOperation_Or;
+    return -1;
+}
+
+// emits the instruction, operations on constants are folded
+static void emitInstruction(QVector<ExpressionInstruction> &instructions, int &depth, int &maximumDepth,
+                            const ExpressionInstruction &instruction)
+{
+    int operands = operandCount(instruction.operation, instruction.index);
+
+    bool constant = (operands > 0 && instructions.size() >= operands);
+    for (int i = 0; constant && i < operands; i++)
+        constant = (instructions[instructions.size() - 1 - i].operation == ExpressionOperation_Constant);
+
+    if (constant)
+    {
+        double a = instructions[instructions.size() - operands].value;
+        if (operands == 1)
+            applyUnary(instruction.operation, instruction.index, &a, 1);
+        else
+            applyBinary(instruction.operation, instruction.index, &a, &instructions.last().value, 1);
+
+        instructions.resize(instructions.size() - operands + 1);
+        instructions.last().value = a;
+        depth -= operands - 1;
+        return;
+    }
+
+    // pow() is much slower than the multiplication
+    if (instruction.operation == ExpressionOperation_Power &&
+            instructions.last().operation == ExpressionOperation_Constant && instructions.last().value == 2.0)
+    {
+        instructions.last().operation = ExpressionOperation_Square;
+        depth--;
+        return;
+    }
+
+    instructions.append(instruction);
+    depth += 1 - operands;
+    maximumDepth = qMax(maximumDepth, depth);
+}
+
+// *************************************************************************************************************************************
+
+Expression::Expression() : m_depth(0)
+{
+}
+
+Expression::Expression(const QString &expression, const QStringList &variables)
+    : m_expression(expression), m_variables(variables), m_depth(0)
+{
+    compile();
+}
+
+bool Expression::uses(int variable) const
+{
+    foreach (ExpressionInstruction instruction, m_instructions)
+        if (instruction.operation == ExpressionOperation_Variable && instruction.index == variable)
+            return true;
+
+    return false;
+}
+
+void Expression::compile()
+{
+    LexicalAnalyser lexer;
+    lexer.setExpression(m_expression);
+    QList<Token> tokens = lexer.tokens();
+
+    if (tokens.isEmpty())
+        throw ParserException(QObject::tr("Empty expression"), m_expression, 0, "");
+
+    // shunting-yard, operator stack holds operations, parentheses and functions
+    QVector<ExpressionInstruction> operators;
+    // arguments counted in the open parentheses, -1 for parentheses without function
+    QVector<int> arguments;
+    int depth = 0;
+    bool expectOperand = true;
+
+    m_instructions.clear();
+    m_depth = 0;
+
+    for (int t = 0; t < tokens.count(); t++)
+    {
+        Token token = tokens[t];
+        QString text = token.toString();
+
+        ExpressionInstruction instruction;
+        instruction.index = 0;
+        instruction.value = 0.0;
+
+        // signed number directly after an operand is a binary operator (the lexer joins "-1" in "(x)-1")
+        if (token.type() == ParserTokenType_NUMBER && !expectOperand && (text.startsWith("-") || text.startsWith("+")))
+        {
+            tokens.insert(t + 1, Token(ParserTokenType_NUMBER, text.mid(1), 0, token.position() + 1));
+            token = Token(ParserTokenType_OPERATOR, text.left(1), 0, token.position());
+            text = token.toString();
+        }
+
+        if (token.type() == ParserTokenType_NUMBER || token.type() == ParserTokenType_VARIABLE || token.type() == ParserTokenType_KEYWORD)
+        {
+            if (!expectOperand)
+                throw ParserException(QObject::tr("Missing operator before '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            if (token.type() == ParserTokenType_NUMBER)
+            {
+                instruction.operation = ExpressionOperation_Constant;
+                instruction.value = text.toDouble();
+            }
+            else if (m_variables.contains(text))
+            {
+                instruction.operation = ExpressionOperation_Variable;
+                instruction.index = m_variables.indexOf(text);
+            }
+            else if (text == "pi")
+            {
+                instruction.operation = ExpressionOperation_Constant;
+                instruction.value = M_PI;
+            }
+            else if (text == "e")
+            {
+                instruction.operation = ExpressionOperation_Constant;
+                instruction.value = M_E;
+            }
+            else
+            {
+                throw ParserException(QObject::tr("Unknown variable '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+            }
+
+            emitInstruction(m_instructions, depth, m_depth, instruction);
+            expectOperand = false;
+        }
+        else if (token.type() == ParserTokenType_FUNCTION)
+        {
+            int function = -1;
+            for (int i = 0; i < expressionFunctionCount; i++)
+                if (text == expressionFunctions[i].name)
+                    function = i;
+
+            if (function == -1 || !expectOperand)
+                throw ParserException(QObject::tr("Unknown function '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            instruction.operation = ExpressionOperation_Function;
+            instruction.index = function;
+            operators.append(instruction);
+        }
+        else if (text == "(")
+        {
+            if (!expectOperand)
+                throw ParserException(QObject::tr("Missing operator before '(' on position %1 in expression '%2'").
+                                      arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            bool function = (!operators.isEmpty() && operators.last().operation == ExpressionOperation_Function &&
+                             t > 0 && tokens[t - 1].type() == ParserTokenType_FUNCTION);
+            arguments.append(function ? 1 : -1);
+
+            instruction.operation = ExpressionOperation_Parenthesis;
+            operators.append(instruction);
+        }
+        else if (text == ")" || text == ",")
+        {
+            if (expectOperand)
+                throw ParserException(QObject::tr("Missing operand before '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            while (!operators.isEmpty() && operators.last().operation != ExpressionOperation_Parenthesis)
+                emitInstruction(m_instructions, depth, m_depth, operators.takeLast());
+
+            if (operators.isEmpty())
+                throw ParserException(QObject::tr("Unbalanced '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            if (text == ",")
+            {
+                if (arguments.last() == -1)
+                    throw ParserException(QObject::tr("Unexpected ',' on position %1 in expression '%2'").
+                                          arg(token.position()).arg(m_expression),
+                                          m_expression, token.position(), text);
+                arguments.last()++;
+                expectOperand = true;
+                continue;
+            }
+
+            operators.removeLast();
+            int count = arguments.takeLast();
+            if (count != -1)
+            {
+                ExpressionInstruction function = operators.takeLast();
+                if (count != expressionFunctions[function.index].arguments)
+                    throw ParserException(QObject::tr("Function '%1' expects %2 argument(s) in expression '%3'").
+                                          arg(expressionFunctions[function.index].name).
+                                          arg(expressionFunctions[function.index].arguments).arg(m_expression),
+                                          m_expression, token.position(), text);
+
+                emitInstruction(m_instructions, depth, m_depth, function);
+            }
+            expectOperand = false;
+        }
+        else if (expectOperand && (text == "-" || text == "+"))
+        {
+            // unary plus is ignored
+            if (text == "-")
+            {
+                instruction.operation = ExpressionOperation_Negate;
+                operators.append(instruction);
+            }
+        }
+        else
+        {
+            int operation = binaryOperation(text);
+            if (operation == -1)
+                throw ParserException(QObject::tr("Unsupported operator '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            if (expectOperand)
+                throw ParserException(QObject::tr("Missing operand before '%1' on position %2 in expression '%3'").
+                                      arg(text).arg(token.position()).arg(m_expression),
+                                      m_expression, token.position(), text);
+
+            // power is right associative
+            int current = precedence(operation);
+            while (!operators.isEmpty() && operators.last().operation != ExpressionOperation_Parenthesis &&
+                   operators.last().operation != ExpressionOperation_Function)
+            {
+                int top = precedence(operators.last().operation);
+                if (top > current || (top == current && operation != ExpressionOperation_Power))
+                    emitInstruction(m_instructions, depth, m_depth, operators.takeLast());
+                else
+                    break;
+            }
+
+            instruction.operation = operation;
+            operators.append(instruction);
+            expectOperand = true;
+        }
+    }
+
+    if (expectOperand)
+        throw ParserException(QObject::tr("Unexpected end of expression '%1'").arg(m_expression),
+                              m_expression, m_expression.length(), "");
+
+    while (!operators.isEmpty())
+    {
+        if (operators.last().operation == ExpressionOperation_Parenthesis)
+            throw ParserException(QObject::tr("Unbalanced '(' in expression '%1'").arg(m_expression),
+                                  m_expression, m_expression.length(), "(");
+
+        emitInstruction(m_instructions, depth, m_depth, operators.takeLast());
+    }
+
+    assert(depth == 1);
+}
+
+void Expression::evaluateBlock(const QVector<const double *> &arguments, int offset, int count,
+                               double *stack, double *result) const
+{
+    // stack slots are EXPRESSIONBLOCK values apart
+    double *top = stack - EXPRESSIONBLOCK;
+
+    foreach (ExpressionInstruction instruction, m_instructions)
+    {
+        switch (instruction.operation)
+        {
+        case ExpressionOperation_Constant:
+            top += EXPRESSIONBLOCK;
+            for (int i = 0; i < count; i++)
+                top[i] = instruction.value;
+            break;
+        case ExpressionOperation_Variable:
+            top += EXPRESSIONBLOCK;
+            memcpy(top, arguments[instruction.index] + offset, count * sizeof(double));
+            break;
+        default:
+            if (operandCount(instruction.operation, instruction.index) == 1)
+            {
+                applyUnary(instruction.operation, instruction.index, top, count);
+            }
+            else
+            {
+                top -= EXPRESSIONBLOCK;
+                applyBinary(instruction.operation, instruction.index, top, top + EXPRESSIONBLOCK, count);
+            }
+        }
+    }
+
+    memcpy(result + offset, stack, count * sizeof(double));
+}
+
+void Expression::evaluate(const QVector<const double *> &arguments, int count, double *result) const
+{
+    if (m_instructions.isEmpty())
+        return;
+
+    int blocks = (count + EXPRESSIONBLOCK - 1) / EXPRESSIONBLOCK;
+
+#pragma omp parallel
+    {
+        QVector<double> stack(m_depth * EXPRESSIONBLOCK);
+
+#pragma omp for schedule(dynamic, 16)
+        for (int b = 0; b < blocks; b++)
+        {
+            int offset = b * EXPRESSIONBLOCK;
+            evaluateBlock(arguments, offset, qMin(EXPRESSIONBLOCK, count - offset), stack.data(), result);
+        }
+    }
+}
+
+double Expression::evaluate(const QVector<double> &arguments) const
+{
+    QVector<const double *> pointers(arguments.count());
+    for (int i = 0; i < arguments.count(); i++)
+        pointers[i] = arguments.constData() + i;
+
+    double result = 0.0;
+    evaluate(pointers, 1, &result);
+
+    return result;
+}
@@ -0,0 +1,73 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef EXPRESSION_H
+#define EXPRESSION_H
+
+#include "util.h"
+
+/// one step of the compiled expression (postfix order)
+struct ExpressionInstruction
+{
+    int operation;
+    // variable or function
+    int index;
+    double value;
+};
+
+/// arithmetic expression over named variables, compiled once to postfix instructions
+/// operators + - * / ^ ** (power), comparisons and && || (1 or 0), unary minus,
+/// functions of one (sin, cos, tan, asin, acos, atan, sinh, cosh, tanh, exp, log, log10, sqrt, abs, sign)
+/// and two arguments (pow, atan2, min, max), constants pi and e
+/// evaluation runs over whole arrays: instructions are executed one by one on blocks of values,
+/// so every instruction is a tight loop, blocks are evaluated in parallel
+class Expression
+{
+public:
+    Expression();
+    /// throws ParserException on unknown symbols or syntax errors
+    Expression(const QString &expression, const QStringList &variables);
+
+    inline QString expression() const { return m_expression; }
+    inline bool isEmpty() const { return m_instructions.isEmpty(); }
+
+    /// variables the expression is compiled for
+    inline QStringList variables() const { return m_variables; }
+    /// the variable appears in the expression
+    bool uses(int variable) const;
+
+    /// result[i] = f(arguments[0][i], arguments[1][i], ...), arguments in the order of variables()
+    /// (arguments of unused variables may be NULL)
+    void evaluate(const QVector<const double *> &arguments, int count, double *result) const;
+    /// single value
+    double evaluate(const QVector<double> &arguments) const;
+
+private:
+    QString m_expression;
+    QStringList m_variables;
+
+    QVector<ExpressionInstruction> m_instructions;
+    int m_depth;
+
+    void compile();
+    void evaluateBlock(const QVector<const double *> &arguments, int offset, int count,
+                       double *stack, double *result) const;
+};
+
+#endif // EXPRESSION_H
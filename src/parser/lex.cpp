@@ -164,7 +164,7 @@ void LexicalAnalyser::setExpression(const QString &expr)
             if(index == position)
             {
                 position =  index + terminal.m_pattern.capturedTexts()[0].count();
-                Token token(terminal.m_terminalType,terminal.m_pattern.capturedTexts()[0], index);
+                Token token(terminal.m_terminalType, terminal.m_pattern.capturedTexts()[0], 0, index);
                 m_tokens.append(token);
                 match = true;
             }
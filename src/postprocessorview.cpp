@@ -29,6 +29,8 @@
 #include "pythonlabagros.h"
 
 #include "field/problem.h"
+#include "field/statistics.h"
+#include "field/solutiongrid.h"
 
 #include "util/constants.h"
 
@@ -51,6 +53,11 @@ PostprocessorWidget::PostprocessorWidget(SceneViewPreprocessor *sceneGeometry,
 
     connect(currentPythonEngineAgros(), SIGNAL(executedScript()), this, SLOT(updateControls()));
     connect(currentPythonEngineAgros(), SIGNAL(executedExpression()), this, SLOT(updateControls()));
+
+    // automatic range follows the progressive solve
+    connect(Util::problem(), SIGNAL(solutionRefined(int)), this, SLOT(doScalarFieldRangeUpdate()));
+    connect(Util::problem(), SIGNAL(solved()), this, SLOT(doScalarFieldRangeUpdate()));
+    connect(Util::problem(), SIGNAL(derivedQuantitiesChanged()), this, SLOT(updateControls()));
 }
 
 void PostprocessorWidget::loadBasic()
@@ -59,13 +66,24 @@ void PostprocessorWidget::loadBasic()
     radPost3DNone->setChecked(Util::config()->showPost3D == SceneViewPost3DMode_None);
     radPost3DScalarField3D->setChecked(Util::config()->showPost3D == SceneViewPost3DMode_ScalarView3D);
     radPost3DModel->setChecked(Util::config()->showPost3D == SceneViewPost3DMode_Model);
+    radPost3DParticleTracing->setChecked(Util::config()->showPost3D == SceneViewPost3DMode_ParticleTracing);
+
+    // particle tracing
+    txtParticleNumberOfParticles->setValue(Util::config()->particleNumberOfParticles);
 
     // scalar field
+    cmbPostScalarFieldVariable->clear();
+    cmbPostScalarFieldVariable->addItem(tr("Potential"), QString());
+    foreach (QString name, Util::problem()->derivedQuantities())
+        cmbPostScalarFieldVariable->addItem(name, name);
+    cmbPostScalarFieldVariable->setCurrentIndex(qMax(0, cmbPostScalarFieldVariable->findData(Util::config()->scalarVariable)));
+
     chkShowScalarColorBar->setChecked(Util::config()->showScalarColorBar);
     cmbPalette->setCurrentIndex(cmbPalette->findData(Util::config()->paletteType));
     chkPaletteFilter->setChecked(Util::config()->paletteFilter);
     doPaletteFilter(chkPaletteFilter->checkState());
     txtPaletteSteps->setValue(Util::config()->paletteSteps);
+    txtIsoSurfacesCount->setValue(Util::config()->isoSurfacesCount);
 
     refresh();
 }
@@ -78,12 +96,18 @@ void PostprocessorWidget::saveBasic()
     if (radPost3DNone->isChecked()) Util::config()->showPost3D = SceneViewPost3DMode_None;
     if (radPost3DScalarField3D->isChecked()) Util::config()->showPost3D = SceneViewPost3DMode_ScalarView3D;
     if (radPost3DModel->isChecked()) Util::config()->showPost3D = SceneViewPost3DMode_Model;
+    if (radPost3DParticleTracing->isChecked()) Util::config()->showPost3D = SceneViewPost3DMode_ParticleTracing;
+
+    // particle tracing
+    Util::config()->particleNumberOfParticles = txtParticleNumberOfParticles->value();
 
     // scalar field
+    Util::config()->scalarVariable = cmbPostScalarFieldVariable->itemData(cmbPostScalarFieldVariable->currentIndex()).toString();
     Util::config()->showScalarColorBar = chkShowScalarColorBar->isChecked();
     Util::config()->paletteType = (PaletteType) cmbPalette->itemData(cmbPalette->currentIndex()).toInt();
     Util::config()->paletteFilter = chkPaletteFilter->isChecked();
     Util::config()->paletteSteps = txtPaletteSteps->value();
+    Util::config()->isoSurfacesCount = txtIsoSurfacesCount->value();
 
     // save
     Util::config()->save();
@@ -119,28 +143,46 @@ QWidget *PostprocessorWidget::post3DWidget()
     radPost3DNone = new QRadioButton(tr("None"), this);
     radPost3DScalarField3D = new QRadioButton(tr("Scalar view"), this);
     radPost3DModel = new QRadioButton("Model", this);
+    radPost3DParticleTracing = new QRadioButton(tr("Particle tracing"), this);
 
     butPost3DGroup = new QButtonGroup(this);
     butPost3DGroup->addButton(radPost3DNone);
     butPost3DGroup->addButton(radPost3DScalarField3D);
     butPost3DGroup->addButton(radPost3DModel);
+    butPost3DGroup->addButton(radPost3DParticleTracing);
     connect(butPost3DGroup, SIGNAL(buttonClicked(QAbstractButton*)), this, SLOT(doPostprocessorGroupClicked(QAbstractButton*)));
 
     QGridLayout *layoutPost3D = new QGridLayout();
     layoutPost3D->addWidget(radPost3DNone, 0, 0);
     layoutPost3D->addWidget(radPost3DScalarField3D, 1, 0);
     layoutPost3D->addWidget(radPost3DModel, 1, 1);
+    layoutPost3D->addWidget(radPost3DParticleTracing, 2, 0);
 
     QHBoxLayout *layoutShowPost3D = new QHBoxLayout();
     layoutShowPost3D->addLayout(layoutPost3D);
     layoutShowPost3D->addStretch(1);
 
+    // particle tracing
+    txtParticleNumberOfParticles = new QSpinBox(this);
+    txtParticleNumberOfParticles->setMinimum(PARTICLENUMBEROFPARTICLESMIN);
+    txtParticleNumberOfParticles->setMaximum(PARTICLENUMBEROFPARTICLESMAX);
+
+    QGridLayout *layoutParticleTracing = new QGridLayout();
+    layoutParticleTracing->setColumnMinimumWidth(0, minWidth);
+    layoutParticleTracing->setColumnStretch(1, 1);
+    layoutParticleTracing->addWidget(new QLabel(tr("Particles:")), 0, 0);
+    layoutParticleTracing->addWidget(txtParticleNumberOfParticles, 0, 1);
+
+    QGroupBox *grpParticleTracing = new QGroupBox(tr("Particle tracing"));
+    grpParticleTracing->setLayout(layoutParticleTracing);
+
     QGroupBox *grpShowPost3D = new QGroupBox(tr("Postprocessor 3D"));
     grpShowPost3D->setLayout(layoutShowPost3D);
 
     QVBoxLayout *layout = new QVBoxLayout();
     layout->setMargin(0);
     layout->addWidget(grpShowPost3D);
+    layout->addWidget(grpParticleTracing);
     layout->addStretch(1);
 
     QWidget *widget = new QWidget(this);
@@ -175,6 +217,11 @@ CollapsableGroupBoxButton *PostprocessorWidget::postScalarWidget()
     chkScalarFieldRangeAuto = new QCheckBox(tr("Auto range"));
     connect(chkScalarFieldRangeAuto, SIGNAL(stateChanged(int)), this, SLOT(doScalarFieldRangeAuto(int)));
 
+    // isosurfaces
+    txtIsoSurfacesCount = new QSpinBox(this);
+    txtIsoSurfacesCount->setMinimum(ISOSURFACESCOUNTMIN);
+    txtIsoSurfacesCount->setMaximum(ISOSURFACESCOUNTMAX);
+
     groupPostScalarAdvanced = postScalarAdvancedWidget();
 
     QGridLayout *layoutScalarField = new QGridLayout();
@@ -182,6 +229,8 @@ CollapsableGroupBoxButton *PostprocessorWidget::postScalarWidget()
     layoutScalarField->setColumnStretch(1, 1);
     layoutScalarField->addWidget(new QLabel(tr("Variable:")), 0, 0);
     layoutScalarField->addWidget(cmbPostScalarFieldVariable, 0, 1);
+    layoutScalarField->addWidget(new QLabel(tr("Isosurfaces:")), 1, 0);
+    layoutScalarField->addWidget(txtIsoSurfacesCount, 1, 1);
     layoutScalarField->addWidget(groupPostScalarAdvanced, 2, 0, 1, 2);
 
     CollapsableGroupBoxButton *grpScalarField = new CollapsableGroupBoxButton(tr("Scalar field"));
@@ -304,6 +353,8 @@ void PostprocessorWidget::refresh()
         radPost3DNone->setEnabled(Util::problem()->isSolved());
         radPost3DScalarField3D->setEnabled(Util::problem()->isSolved());
         radPost3DModel->setEnabled(Util::problem()->isSolved());
+        radPost3DParticleTracing->setEnabled(Util::problem()->isSolved());
+        txtParticleNumberOfParticles->setEnabled(radPost3DParticleTracing->isEnabled() && radPost3DParticleTracing->isChecked());
 
         // scalar
         groupPostScalar->setVisible(radPost3DScalarField3D->isEnabled() && radPost3DScalarField3D->isChecked());
@@ -329,6 +380,33 @@ void PostprocessorWidget::doScalarFieldRangeAuto(int state)
 {
     txtScalarFieldRangeMin->setEnabled(!chkScalarFieldRangeAuto->isChecked());
     txtScalarFieldRangeMax->setEnabled(!chkScalarFieldRangeAuto->isChecked());
+
+    doScalarFieldRangeUpdate();
+}
+
+void PostprocessorWidget::doScalarFieldRangeUpdate()
+{
+    if (!chkScalarFieldRangeAuto->isChecked() || !Util::problem()->isSolved())
+        return;
+
+    // cached for the step, refined levels add only their new points
+    Statistics statistics = Util::problem()->statistics()->statistics(StatisticsQuantity_Potential);
+
+    // derived quantity (computed here if not displayed yet)
+    QString variable = cmbPostScalarFieldVariable->itemData(cmbPostScalarFieldVariable->currentIndex()).toString();
+    if (Util::problem()->derivedQuantity(variable))
+    {
+        const SolutionGrid *grid = Util::problem()->quantity(variable);
+
+        statistics.clear();
+        statistics.add(grid->values(), grid->count());
+    }
+
+    if (statistics.isEmpty())
+        return;
+
+    txtScalarFieldRangeMin->setValue(statistics.min());
+    txtScalarFieldRangeMax->setValue(statistics.max());
 }
 
 void PostprocessorWidget::doScalarFieldRangeMinChanged()
@@ -51,10 +51,15 @@ private:
     QRadioButton *radPost3DNone;
     QRadioButton *radPost3DScalarField3D;
     QRadioButton *radPost3DModel;
+    QRadioButton *radPost3DParticleTracing;
+
+    // particle tracing
+    QSpinBox *txtParticleNumberOfParticles;
 
     // scalar field
     QComboBox *cmbPostScalarFieldVariable;
     QComboBox *cmbPostScalarFieldVariableComp;
+    QSpinBox *txtIsoSurfacesCount;
     QCheckBox *chkScalarFieldRangeAuto;
     QLabel *lblScalarFieldRangeMin;
     QLabel *lblScalarFieldRangeMax;
@@ -106,6 +111,7 @@ private slots:
     void doPaletteFilter(int state);
 
     void doScalarFieldRangeAuto(int state);
+    void doScalarFieldRangeUpdate();
     void doScalarFieldRangeMinChanged();
     void doScalarFieldRangeMaxChanged();
     void doPostprocessorGroupClicked(QAbstractButton *button);
@@ -0,0 +1,393 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "preprocessormodel.h"
+
+#include "util/constants.h"
+
+#include "scene.h"
+#include "scenenode.h"
+
+PreprocessorModel::PreprocessorModel(QObject *parent) : QAbstractItemModel(parent), m_fetched(0)
+{
+    m_iconNode = icon("scene-node");
+    m_iconNodes = icon("scenenode");
+
+    connect(Util::scene(), SIGNAL(changed(const SceneChangeSet &)), this, SLOT(doSceneChanged(const SceneChangeSet &)));
+    connect(Util::scene(), SIGNAL(cleared()), this, SLOT(synchronize()));
+
+    reset();
+}
+
+QModelIndex PreprocessorModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (row < 0 || column != 0 || row >= rowCount(parent))
+        return QModelIndex();
+
+    if (!parent.isValid())
+        return geometryIndex();
+    if (parent.internalId() == Level_Geometry)
+        return nodesIndex();
+
+    return createIndex(row, 0, Level_Node);
+}
+
+QModelIndex PreprocessorModel::parent(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.internalId() == Level_Geometry)
+        return QModelIndex();
+    if (index.internalId() == Level_Nodes)
+        return geometryIndex();
+
+    return nodesIndex();
+}
+
+int PreprocessorModel::rowCount(const QModelIndex &parent) const
+{
+    if (!parent.isValid())
+        return 1;
+    if (parent.internalId() == Level_Geometry)
+        return 1;
+    if (parent.internalId() == Level_Nodes)
+        return m_fetched;
+
+    return 0;
+}
+
+int PreprocessorModel::columnCount(const QModelIndex &parent) const
+{
+    return 1;
+}
+
+bool PreprocessorModel::hasChildren(const QModelIndex &parent) const
+{
+    // nodes can be expanded before their rows are fetched
+    if (parent.isValid() && parent.internalId() == Level_Nodes)
+        return !m_ids.isEmpty();
+
+    return rowCount(parent) > 0;
+}
+
+QVariant PreprocessorModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid())
+        return QVariant();
+
+    if (index.internalId() == Level_Node)
+    {
+        SceneNode *node = this->node(index);
+        if (!node)
+            return QVariant();
+
+        switch (role)
+        {
+        case Qt::DisplayRole:
+            return label(node->id(), node->point());
+        case Qt::DecorationRole:
+            return m_iconNode;
+        case Qt::UserRole:
+            return node->variant();
+        }
+
+        return QVariant();
+    }
+
+    if (role == Qt::FontRole)
+    {
+        QFont font = QApplication::font();
+        font.setBold(true);
+        return font;
+    }
+
+    if (index.internalId() == Level_Geometry)
+    {
+        if (role == Qt::DisplayRole)
+            return tr("Geometry");
+    }
+    else
+    {
+        if (role == Qt::DisplayRole)
+            return tr("Nodes (%1)").arg(m_ids.count());
+        if (role == Qt::DecorationRole)
+            return m_iconNodes;
+    }
+
+    return QVariant();
+}
+
+bool PreprocessorModel::canFetchMore(const QModelIndex &parent) const
+{
+    return parent.isValid() && parent.internalId() == Level_Nodes && m_fetched < m_ids.count();
+}
+
+void PreprocessorModel::fetchMore(const QModelIndex &parent)
+{
+    if (!canFetchMore(parent))
+        return;
+
+    int count = qMin(PREPROCESSORFETCHCHUNK, m_ids.count() - m_fetched);
+
+    beginInsertRows(nodesIndex(), m_fetched, m_fetched + count - 1);
+    m_fetched += count;
+    endInsertRows();
+}
+
+SceneNode *PreprocessorModel::node(const QModelIndex &index) const
+{
+    if (!index.isValid() || index.internalId() != Level_Node || index.row() >= m_fetched)
+        return NULL;
+
+    return Util::scene()->nodes->find(m_ids[index.row()]);
+}
+
+void PreprocessorModel::setFilter(const QString &filter)
+{
+    if (m_filter == filter)
+        return;
+
+    m_filter = filter;
+    reset();
+}
+
+void PreprocessorModel::synchronize()
+{
+    if (m_known.count() != Util::scene()->nodes->ids().count())
+        reset();
+}
+
+QString PreprocessorModel::label(int id, const Point3 &point)
+{
+    return QString("%1 - [%2; %3; %4]").
+            arg(id).
+            arg(point.x, 0, 'e', 2).
+            arg(point.y, 0, 'e', 2).
+            arg(point.z, 0, 'e', 2);
+}
+
+bool PreprocessorModel::matches(int id, const Point3 &point) const
+{
+    return m_filter.isEmpty() || label(id, point).contains(m_filter, Qt::CaseInsensitive);
+}
+
+void PreprocessorModel::reset()
+{
+    beginResetModel();
+
+    m_known = Util::scene()->nodes->ids();
+    m_ids.clear();
+    m_fetched = 0;
+
+    if (m_filter.isEmpty())
+    {
+        m_ids.reserve(m_known.count());
+        for (int id = m_known.next(0); id != -1; id = m_known.next(id + 1))
+            m_ids.append(id);
+    }
+    else
+    {
+        // labels are matched in parallel on the snapshot (immutable), listed ids are collected in order
+        SceneSnapshot snapshot = Util::scene()->snapshot();
+        QVector<int> ids = snapshot.ids();
+        QVector<Point3> points = snapshot.points().toVector();
+
+        QVector<char> match(ids.count());
+        const int *pi = ids.constData();
+        const Point3 *pp = points.constData();
+        char *pm = match.data();
+
+#pragma omp parallel for schedule(dynamic, 1024)
+        for (int i = 0; i < ids.count(); i++)
+            pm[i] = matches(pi[i], pp[i]);
+
+        for (int i = 0; i < ids.count(); i++)
+            if (pm[i])
+                m_ids.append(pi[i]);
+    }
+
+    endResetModel();
+}
+
+bool PreprocessorModel::insertIds(const QVector<int> &ids)
+{
+    // positions of the ids in the list, consecutive ids with the same position form a block
+    QVector<int> positions;
+    QVector<int> inserted;
+    positions.reserve(ids.count());
+    inserted.reserve(ids.count());
+    int blocks = 0;
+    foreach (int id, ids)
+    {
+        int position = qLowerBound(m_ids.constBegin(), m_ids.constEnd(), id) - m_ids.constBegin();
+        if (position < m_ids.count() && m_ids[position] == id)
+            continue;
+
+        if (positions.isEmpty() || positions.last() != position)
+            blocks++;
+        positions.append(position);
+        inserted.append(id);
+    }
+
+    if (blocks > PREPROCESSORMAXIMUMBLOCKS)
+        return false;
+
+    // blocks from the last one, positions of the previous ones stay valid
+    int end = inserted.count();
+    while (end > 0)
+    {
+        int begin = end - 1;
+        while (begin > 0 && positions[begin - 1] == positions[end - 1])
+            begin--;
+
+        int position = positions[begin];
+        int count = end - begin;
+
+        // rows inside the fetched part are shown, rows appended to a fully fetched list up to one chunk,
+        // the rest is fetched later
+        int shown = 0;
+        if (position < m_fetched)
+            shown = count;
+        else if (position == m_fetched && m_fetched == m_ids.count())
+            shown = qBound(0, PREPROCESSORFETCHCHUNK - m_fetched, count);
+
+        if (shown > 0)
+            beginInsertRows(nodesIndex(), position, position + shown - 1);
+
+        m_ids.insert(position, count, 0);
+        for (int i = 0; i < count; i++)
+            m_ids[position + i] = inserted[begin + i];
+        m_fetched += shown;
+
+        if (shown > 0)
+            endInsertRows();
+
+        end = begin;
+    }
+
+    return true;
+}
+
+bool PreprocessorModel::removeIds(const QVector<int> &ids)
+{
+    // rows of the listed ids (ascending)
+    QVector<int> rows;
+    rows.reserve(ids.count());
+    int blocks = 0;
+    foreach (int id, ids)
+    {
+        QVector<int>::const_iterator it = qBinaryFind(m_ids.constBegin(), m_ids.constEnd(), id);
+        if (it == m_ids.constEnd())
+            continue;
+
+        int row = it - m_ids.constBegin();
+        if (rows.isEmpty() || rows.last() != row - 1)
+            blocks++;
+        rows.append(row);
+    }
+
+    if (blocks > PREPROCESSORMAXIMUMBLOCKS)
+        return false;
+
+    // blocks of consecutive rows from the last one
+    int end = rows.count();
+    while (end > 0)
+    {
+        int begin = end - 1;
+        while (begin > 0 && rows[begin - 1] == rows[begin] - 1)
+            begin--;
+
+        int first = rows[begin];
+        int last = rows[end - 1];
+        int shownLast = qMin(last, m_fetched - 1);
+
+        if (first <= shownLast)
+            beginRemoveRows(nodesIndex(), first, shownLast);
+
+        m_ids.remove(first, last - first + 1);
+        if (first <= shownLast)
+        {
+            m_fetched -= shownLast - first + 1;
+            endRemoveRows();
+        }
+
+        end = begin;
+    }
+
+    return true;
+}
+
+void PreprocessorModel::doSceneChanged(const SceneChangeSet &changes)
+{
+    if (!changes.isGeometryChanged())
+        return;
+
+    QVector<int> removed;
+    QVector<int> added;
+
+    for (int id = changes.removed.next(0); id != -1; id = changes.removed.next(id + 1))
+    {
+        if (m_known.contains(id))
+        {
+            m_known.remove(id);
+            removed.append(id);
+        }
+    }
+
+    for (int id = changes.added.next(0); id != -1; id = changes.added.next(id + 1))
+    {
+        SceneNode *node = Util::scene()->nodes->find(id);
+        if (!node)
+            continue;
+
+        m_known.insert(id);
+        if (matches(id, node->point()))
+            added.append(id);
+    }
+
+    // moved nodes can leave or enter the filter
+    if (!m_filter.isEmpty())
+    {
+        for (int id = changes.moved.next(0); id != -1; id = changes.moved.next(id + 1))
+        {
+            SceneNode *node = Util::scene()->nodes->find(id);
+            if (!node)
+                continue;
+
+            bool isListed = qBinaryFind(m_ids.constBegin(), m_ids.constEnd(), id) != m_ids.constEnd();
+            bool isMatching = matches(id, node->point());
+            if (isListed && !isMatching)
+                removed.append(id);
+            else if (!isListed && isMatching)
+                added.append(id);
+        }
+
+        qSort(removed);
+        qSort(added);
+    }
+
+    if (!removeIds(removed) || !insertIds(added))
+    {
+        reset();
+        return;
+    }
+
+    // labels of the shown rows (the view repaints only the visible ones) and the number of nodes
+    if (m_fetched > 0 && !changes.moved.isEmpty())
+        emit dataChanged(index(0, 0, nodesIndex()), index(m_fetched - 1, 0, nodesIndex()));
+    emit dataChanged(nodesIndex(), nodesIndex());
+}
@@ -0,0 +1,93 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef PREPROCESSORMODEL_H
+#define PREPROCESSORMODEL_H
+
+#include "util.h"
+#include "scenebasic.h"
+
+class SceneNode;
+
+/// tree of the scene objects for the preprocessor view (Geometry - Nodes - nodes in the order of their ids)
+/// node rows are fetched in chunks as the view scrolls, change sets of the scene insert or remove only the affected
+/// rows (scattered changes reset the model), the filter is a case insensitive part of the label evaluated in parallel
+class PreprocessorModel : public QAbstractItemModel
+{
+    Q_OBJECT
+
+public:
+    enum Level
+    {
+        Level_Geometry,
+        Level_Nodes,
+        Level_Node
+    };
+
+    PreprocessorModel(QObject *parent = 0);
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const;
+    QModelIndex parent(const QModelIndex &index) const;
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+    bool canFetchMore(const QModelIndex &parent) const;
+    void fetchMore(const QModelIndex &parent);
+
+    inline QModelIndex geometryIndex() const { return createIndex(0, 0, Level_Geometry); }
+    inline QModelIndex nodesIndex() const { return createIndex(0, 0, Level_Nodes); }
+
+    /// node of the row or NULL
+    SceneNode *node(const QModelIndex &index) const;
+    /// number of listed (not filtered out) nodes
+    inline int nodeCount() const { return m_ids.count(); }
+
+    inline QString filter() const { return m_filter; }
+    void setFilter(const QString &filter);
+
+public slots:
+    /// rebuilds the model if it missed changes of the scene (notifications are blocked while a file is read)
+    void synchronize();
+
+private:
+    /// ids of the listed nodes (ascending), the first m_fetched of them are rows
+    QVector<int> m_ids;
+    int m_fetched;
+    /// ids of all nodes the model knows about (filtered out too)
+    SceneBitSet m_known;
+
+    QString m_filter;
+    QIcon m_iconNode;
+    QIcon m_iconNodes;
+
+    static QString label(int id, const Point3 &point);
+    bool matches(int id, const Point3 &point) const;
+
+    void reset();
+    /// false if the ids are too scattered to be inserted (removed) as few blocks of rows
+    bool insertIds(const QVector<int> &ids);
+    bool removeIds(const QVector<int> &ids);
+
+private slots:
+    void doSceneChanged(const SceneChangeSet &changes);
+};
+
+#endif // PREPROCESSORMODEL_H
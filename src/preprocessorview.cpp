@@ -18,6 +18,7 @@
 // Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
 
 #include "preprocessorview.h"
+#include "preprocessormodel.h"
 
 #include "util/constants.h"
 
@@ -54,11 +55,11 @@ PreprocessorWidget::PreprocessorWidget(SceneViewPreprocessor *sceneView, QWidget
     connect(currentPythonEngineAgros(), SIGNAL(executedScript()), this, SLOT(refresh()));
 
     connect(trvWidget, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(doContextMenu(const QPoint &)));
-    connect(trvWidget, SIGNAL(itemActivated(QTreeWidgetItem *, int)), this, SLOT(doItemSelected(QTreeWidgetItem *, int)));
-    connect(trvWidget, SIGNAL(itemPressed(QTreeWidgetItem *, int)), this, SLOT(doItemSelected(QTreeWidgetItem *, int)));
-    connect(trvWidget, SIGNAL(itemDoubleClicked(QTreeWidgetItem *, int)), this, SLOT(doItemDoubleClicked(QTreeWidgetItem *, int)));
+    connect(trvWidget, SIGNAL(activated(const QModelIndex &)), this, SLOT(doItemSelected(const QModelIndex &)));
+    connect(trvWidget, SIGNAL(pressed(const QModelIndex &)), this, SLOT(doItemSelected(const QModelIndex &)));
+    connect(trvWidget, SIGNAL(doubleClicked(const QModelIndex &)), this, SLOT(doItemDoubleClicked(const QModelIndex &)));
 
-    doItemSelected(NULL, Qt::UserRole);
+    doItemSelected(QModelIndex());
 
     QSettings settings;
     splitter->restoreState(settings.value("PreprocessorView/SplitterState").toByteArray());
@@ -104,17 +105,40 @@ void PreprocessorWidget::createControls()
     QWidget *widgetInfo = new QWidget(this);
     widgetInfo->setLayout(layoutInfo);
 
-    trvWidget = new QTreeWidget(this);
+    // rows of the model are fetched as the view scrolls, uniform rows are laid out without asking for their data
+    m_model = new PreprocessorModel(this);
+
+    trvWidget = new QTreeView(this);
+    trvWidget->setModel(m_model);
     trvWidget->setHeaderHidden(true);
     trvWidget->setContextMenuPolicy(Qt::CustomContextMenu);
     trvWidget->setMouseTracking(true);
-    trvWidget->setColumnCount(1);
     trvWidget->setColumnWidth(0, 150);
     trvWidget->setIndentation(12);
+    trvWidget->setUniformRowHeights(true);
+
+    // filter is applied after a pause in typing, return selects the first node
+    txtFilter = new QLineEdit(this);
+    txtFilter->setToolTip(tr("Filter nodes (part of the label)"));
+    connect(txtFilter, SIGNAL(returnPressed()), this, SLOT(doFilterFirst()));
+
+    m_filterTimer = new QTimer(this);
+    m_filterTimer->setSingleShot(true);
+    m_filterTimer->setInterval(PREPROCESSORFILTERDELAY);
+    connect(txtFilter, SIGNAL(textChanged(const QString &)), m_filterTimer, SLOT(start()));
+    connect(m_filterTimer, SIGNAL(timeout()), this, SLOT(doFilter()));
+
+    QVBoxLayout *layoutTree = new QVBoxLayout();
+    layoutTree->setMargin(0);
+    layoutTree->addWidget(txtFilter);
+    layoutTree->addWidget(trvWidget);
+
+    QWidget *widgetTree = new QWidget(this);
+    widgetTree->setLayout(layoutTree);
 
     splitter = new QSplitter(Qt::Vertical, this);
     splitter->addWidget(widgetInfo);
-    splitter->addWidget(trvWidget);
+    splitter->addWidget(widgetTree);
 
     /*
     QVBoxLayout *layoutMain = new QVBoxLayout();
@@ -148,76 +172,66 @@ void PreprocessorWidget::refresh()
     // script speed improvement
     if (currentPythonEngine()->isRunning()) return;
 
-    blockSignals(true);
-    setUpdatesEnabled(false);
+    // rows are updated by the change sets of the scene
+    m_model->synchronize();
 
-    trvWidget->clear();
-
-    QFont fnt = trvWidget->font();
-    fnt.setBold(true);
-
-    // geometry
-    QTreeWidgetItem *geometryNode = new QTreeWidgetItem(trvWidget);
-    // geometryNode->setIcon(0, icon("geometry"));
-    geometryNode->setText(0, tr("Geometry"));
-    geometryNode->setFont(0, fnt);
-    geometryNode->setExpanded(false);
+    QTimer::singleShot(0, this, SLOT(showInfo()));
+}
 
-    // nodes
-    QTreeWidgetItem *nodesNode = new QTreeWidgetItem(geometryNode);
-    nodesNode->setText(0, tr("Nodes"));
-    nodesNode->setIcon(0, icon("scenenode"));
-    // nodesNode->setForeground(0, QBrush(Qt::darkBlue));
-    nodesNode->setFont(0, fnt);
+void PreprocessorWidget::doFilter()
+{
+    m_filterTimer->stop();
+    m_model->setFilter(txtFilter->text());
 
-    QList<QTreeWidgetItem *> listNodes;
-    int inode = 0;
-    foreach (SceneNode *node, Util::scene()->nodes->items())
+    if (!m_model->filter().isEmpty())
     {
-        QTreeWidgetItem *item = new QTreeWidgetItem();
+        trvWidget->expand(m_model->geometryIndex());
+        trvWidget->expand(m_model->nodesIndex());
+    }
+}
 
-        item->setText(0, QString("%1 - [%2; %3]").
-                      arg(inode).
-                      arg(node->point().x, 0, 'e', 2).
-                      arg(node->point().y, 0, 'e', 2));
-        item->setIcon(0, icon("scene-node"));
-        item->setData(0, Qt::UserRole, node->variant());
+void PreprocessorWidget::doFilterFirst()
+{
+    doFilter();
 
-        listNodes.append(item);
+    if (m_model->nodeCount() > 0)
+    {
+        if (m_model->canFetchMore(m_model->nodesIndex()))
+            m_model->fetchMore(m_model->nodesIndex());
 
-        inode++;
+        QModelIndex index = m_model->index(0, 0, m_model->nodesIndex());
+        trvWidget->setCurrentIndex(index);
+        trvWidget->scrollTo(index);
+        doItemSelected(index);
     }
-    nodesNode->addChildren(listNodes);
-
-    setUpdatesEnabled(true);
-    blockSignals(false);
-
-    QTimer::singleShot(0, this, SLOT(showInfo()));
 }
 
 void PreprocessorWidget::doContextMenu(const QPoint &pos)
 {
-    QTreeWidgetItem *item = trvWidget->itemAt(pos);
-    doItemSelected(item, 0);
+    QModelIndex index = trvWidget->indexAt(pos);
+    doItemSelected(index);
 
-    trvWidget->setCurrentItem(item);
+    trvWidget->setCurrentIndex(index);
     mnuPreprocessor->exec(QCursor::pos());
 }
 
-void PreprocessorWidget::doItemSelected(QTreeWidgetItem *item, int role)
+void PreprocessorWidget::doItemSelected(const QModelIndex &index)
 {
     createMenu();
 
     actProperties->setEnabled(false);
     actDelete->setEnabled(false);
 
-    if (item != NULL)
+    if (index.isValid())
     {
+        // one change of the selection
+        Util::scene()->beginTransaction();
+
         Util::scene()->selectNone();
         Util::scene()->highlightNone();
 
         // geometry
-        if (SceneBasic *objectBasic = trvWidget->currentItem()->data(0, Qt::UserRole).value<SceneBasic *>())
+        if (SceneBasic *objectBasic = index.data(Qt::UserRole).value<SceneBasic *>())
         {
             m_sceneViewGeometry->actSceneModePreprocessor->trigger();
 
@@ -231,20 +245,22 @@ void PreprocessorWidget::doItemSelected(QTreeWidgetItem *item, int role)
             actProperties->setEnabled(true);
             actDelete->setEnabled(true);
         }
+
+        Util::scene()->commitTransaction();
     }
 }
 
-void PreprocessorWidget::doItemDoubleClicked(QTreeWidgetItem *item, int role)
+void PreprocessorWidget::doItemDoubleClicked(const QModelIndex &index)
 {
     doProperties();
 }
 
 void PreprocessorWidget::doProperties()
 {
-    if (trvWidget->currentItem())
+    if (trvWidget->currentIndex().isValid())
     {
         // geometry
-        if (SceneBasic *objectBasic = trvWidget->currentItem()->data(0, Qt::UserRole).value<SceneBasic *>())
+        if (SceneBasic *objectBasic = trvWidget->currentIndex().data(Qt::UserRole).value<SceneBasic *>())
         {
             if (objectBasic->showDialog(this) == QDialog::Accepted)
             {
@@ -258,14 +274,14 @@ void PreprocessorWidget::doProperties()
 
 void PreprocessorWidget::doDelete()
 {
-    if (trvWidget->currentItem())
+    if (trvWidget->currentIndex().isValid())
     {
-        // scene objects
-        if (SceneBasic *objectBasic = trvWidget->currentItem()->data(0, Qt::UserRole).value<SceneBasic*>())
+        // scene objects, the row is removed by the change set of the command
+        if (SceneBasic *objectBasic = trvWidget->currentIndex().data(Qt::UserRole).value<SceneBasic *>())
         {
             if (SceneNode *node = dynamic_cast<SceneNode *>(objectBasic))
             {
-                Util::scene()->nodes->remove(node);
+                Util::scene()->undoStack()->push(node->getRemoveCommand());
             }
         }
 
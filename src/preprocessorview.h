@@ -26,6 +26,7 @@
 
 class SceneViewPreprocessor;
 class FieldsToobar;
+class PreprocessorModel;
 
 class PreprocessorWidget : public QWidget
 {
@@ -48,7 +49,11 @@ private:
 
     QSplitter *splitter;
 
-    QTreeWidget *trvWidget;
+    QTreeView *trvWidget;
+    PreprocessorModel *m_model;
+
+    QLineEdit *txtFilter;
+    QTimer *m_filterTimer;
 
     QAction *actProperties;
     QAction *actDelete;
@@ -63,8 +68,11 @@ private:
 
 private slots:
     void doContextMenu(const QPoint &pos);
-    void doItemDoubleClicked(QTreeWidgetItem *item, int role);
-    void doItemSelected(QTreeWidgetItem *item, int role);
+    void doItemDoubleClicked(const QModelIndex &index);
+    void doItemSelected(const QModelIndex &index);
+
+    void doFilter();
+    void doFilterFirst();
 
     void showInfo();
 };
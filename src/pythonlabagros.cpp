@@ -29,8 +29,15 @@
 #include "scenenode.h"
 
 #include "field/problem.h"
+#include "field/localvalueprobe.h"
+#include "field/linesampler.h"
+#include "field/solutionstore.h"
+#include "field/integralvalue.h"
+#include "field/solutiongrid.h"
+#include "parser/lex.h"
 
 #include "util/constants.h"
+#include "util/pointgenerator.h"
 
 // current python engine agros
 PythonEngineField *currentPythonEngineAgros()
@@ -179,7 +186,208 @@ void pyCloseDocument()
 
 void pySaveImage(char *str, int w, int h)
 {
-    // ErrorResult result = sceneView()->saveImageToFile(QString(str), w, h);
-    // if (result.isError())
-    //    throw invalid_argument(result.message().toStdString());
+    // rendered offscreen, the view does not have to be visible
+    SceneViewCommon *sceneView = currentPythonEngineAgros()->sceneViewPreprocessor();
+    if (currentPythonEngineAgros()->sceneViewPost3D()->actSceneModePost3D->isChecked())
+        sceneView = currentPythonEngineAgros()->sceneViewPost3D();
+
+    ErrorResult result = sceneView->saveImageToFile(QString(str), w, h);
+    if (result.isError())
+        throw invalid_argument(result.message().toStdString());
+}
+
+void pyLocalValues(vector<double> &x, vector<double> &y, vector<double> &z, vector<double> &values, char *quantity)
+{
+    if (!Util::problem()->isSolved())
+        throw invalid_argument(QObject::tr("Problem is not solved.").toStdString());
+
+    if (x.size() != y.size() || x.size() != z.size())
+        throw invalid_argument(QObject::tr("Coordinates must have the same length.").toStdString());
+
+    QVector<Point3> points(x.size());
+    for (int i = 0; i < points.count(); i++)
+        points[i] = Point3(x[i], y[i], z[i]);
+
+    if (strlen(quantity) > 0)
+    {
+        if (!Util::problem()->derivedQuantity(QString(quantity)))
+            throw invalid_argument(QObject::tr("Derived quantity '%1' is not defined.").arg(quantity).toStdString());
+
+        // values of the derived quantity are interpolated in its grid
+        const SolutionGrid *grid = Util::problem()->quantity(QString(quantity));
+
+        values.assign(points.count(), numeric_limits<double>::quiet_NaN());
+        if (!grid)
+            return;
+
+#pragma omp parallel for
+        for (int i = 0; i < points.count(); i++)
+            if (grid->contains(points[i]))
+                values[i] = grid->interpolate(points[i]);
+
+        return;
+    }
+
+    QVector<double> result = LocalValueProbe::values(Util::problem()->interpolator().data(), points);
+    values.assign(result.constBegin(), result.constEnd());
+}
+
+void pyLineValues(vector<double> &start, vector<double> &end, int count, char *quantity, vector<double> &lengths, vector<double> &values)
+{
+    if (!Util::problem()->isSolved())
+        throw invalid_argument(QObject::tr("Problem is not solved.").toStdString());
+
+    if (start.size() != 3 || end.size() != 3)
+        throw invalid_argument(QObject::tr("Start and end of the line must have three coordinates.").toStdString());
+
+    if (strlen(quantity) > 0 && !Util::problem()->derivedQuantity(QString(quantity)))
+        throw invalid_argument(QObject::tr("Derived quantity '%1' is not defined.").arg(quantity).toStdString());
+
+    const SolutionGrid *grid = Util::problem()->quantity(QString(quantity));
+    if (!grid)
+        throw invalid_argument(QObject::tr("Quantity '%1' cannot be evaluated.").arg(quantity).toStdString());
+
+    LineSampler sampler(Point3(start[0], start[1], start[2]), Point3(end[0], end[1], end[2]));
+    if (count > 0)
+        sampler.setMaximumPoints(count);
+
+    SolutionGridLineFunction function(grid);
+    sampler.sample(&function);
+
+    lengths.resize(sampler.count());
+    for (int i = 0; i < sampler.count(); i++)
+        lengths[i] = sampler.length(i);
+    values.assign(sampler.values().constBegin(), sampler.values().constEnd());
+}
+
+void pyTimeHistory(vector<double> &x, vector<double> &y, vector<double> &z, vector<double> &times, vector<double> &values)
+{
+    if (!Util::problem()->isSolved())
+        throw invalid_argument(QObject::tr("Problem is not solved.").toStdString());
+
+    if (x.size() != y.size() || x.size() != z.size())
+        throw invalid_argument(QObject::tr("Coordinates must have the same length.").toStdString());
+
+    QList<Point3> points;
+    for (unsigned int i = 0; i < x.size(); i++)
+        points.append(Point3(x[i], y[i], z[i]));
+
+    TimeHistory history(Util::problem()->solutionStore());
+    history.extract(points);
+
+    times.assign(history.timeLevels().constBegin(), history.timeLevels().constEnd());
+
+    values.resize(history.pointCount() * history.stepCount());
+    for (int i = 0; i < history.pointCount(); i++)
+        for (int step = 0; step < history.stepCount(); step++)
+            values[i * history.stepCount() + step] = history.value(i, step);
+}
+
+void pyDerivedQuantity(char *name, char *expression)
+{
+    try
+    {
+        Util::problem()->setDerivedQuantity(QString(name), QString(expression));
+    }
+    catch (ParserException &e)
+    {
+        throw invalid_argument(e.what().toStdString());
+    }
+}
+
+void pyRemoveDerivedQuantity(char *name)
+{
+    Util::problem()->removeDerivedQuantity(QString(name));
+}
+
+void pyIntegrals(int dimension, vector<double> &values)
+{
+    if (!Util::problem()->isSolved())
+        throw invalid_argument(QObject::tr("Problem is not solved.").toStdString());
+
+    if (dimension < 1 || dimension > 3)
+        throw invalid_argument(QObject::tr("Dimension must be 1, 2 or 3.").toStdString());
+
+    // calculator of the problem keeps the contributions of the elements between the calls
+    IntegralValue *integral = Util::problem()->integral(dimension);
+    integral->update();
+
+    QVector<double> result = integral->values();
+    values.assign(result.constBegin(), result.constEnd());
+}
+
+/// number of points of a generator (or of one of its directions)
+static int pyCount(double count)
+{
+    if (count < 1.0 || count > SCENEGENERATORMAXIMUM)
+        throw invalid_argument(QObject::tr("Number of points must be from 1 to %1.").arg(SCENEGENERATORMAXIMUM).toStdString());
+
+    return int(count);
+}
+
+int pyAddNodes(char *generator, vector<double> &parameters)
+{
+    // number of parameters of the generators
+    static QMap<QString, int> generators;
+    if (generators.isEmpty())
+    {
+        generators["lattice"] = 9;
+        generators["polar"] = 8;
+        generators["cylindrical"] = 10;
+        generators["line"] = 7;
+        generators["circle"] = 8;
+        generators["helix"] = 7;
+        generators["plane"] = 11;
+        generators["sphere"] = 5;
+    }
+
+    QString name(generator);
+    if (!generators.contains(name))
+        throw invalid_argument(QObject::tr("Generator '%1' is not defined.").arg(name).toStdString());
+    if (int(parameters.size()) != generators[name])
+        throw invalid_argument(QObject::tr("Generator '%1' needs %2 parameters.").arg(name).arg(generators[name]).toStdString());
+
+    const vector<double> &p = parameters;
+    Point3 origin(p[0], p[1], p[2]);
+
+    QVector<Point3> points;
+    if (name == "lattice")
+    {
+        pyCount(double(pyCount(p[6])) * pyCount(p[7]) * pyCount(p[8]));
+        points = PointGenerator::lattice(origin, Point3(p[3], p[4], p[5]), pyCount(p[6]), pyCount(p[7]), pyCount(p[8]));
+    }
+    else if (name == "polar" || name == "cylindrical")
+    {
+        int nz = (name == "cylindrical") ? pyCount(p[8]) : 1;
+        double dz = (name == "cylindrical") ? p[7] : 0.0;
+        pyCount(double(pyCount(p[5])) * pyCount(p[6]) * nz);
+        points = PointGenerator::cylindrical(origin, p[3], p[4], pyCount(p[5]), pyCount(p[6]), dz, nz, p[p.size() - 1]);
+    }
+    else if (name == "line")
+    {
+        points = PointGenerator::line(origin, Point3(p[3], p[4], p[5]), pyCount(p[6]));
+    }
+    else if (name == "circle")
+    {
+        Point3 normal(p[3], p[4], p[5]);
+        if (normal.magnitude() < EPS_ZERO)
+            throw invalid_argument(QObject::tr("Normal of the circle must not be zero.").toStdString());
+
+        points = PointGenerator::circle(origin, normal, p[6], pyCount(p[7]));
+    }
+    else if (name == "helix")
+    {
+        points = PointGenerator::helix(origin, p[3], p[4], p[5], pyCount(p[6]));
+    }
+    else if (name == "plane")
+    {
+        pyCount(double(pyCount(p[9])) * pyCount(p[10]));
+        points = PointGenerator::plane(origin, Point3(p[3], p[4], p[5]), Point3(p[6], p[7], p[8]), pyCount(p[9]), pyCount(p[10]));
+    }
+    else if (name == "sphere")
+    {
+        points = PointGenerator::sphere(origin, p[3], pyCount(p[4]));
+    }
+
+    return Util::scene()->addNodes(points, QObject::tr("Generate nodes (%1)").arg(name));
 }
@@ -112,4 +112,24 @@ void pyCloseDocument();
 
 void pySaveImage(char *str, int w, int h);
 
+// local values in many points at once (NaN outside the solution), derived quantity if given
+void pyLocalValues(vector<double> &x, vector<double> &y, vector<double> &z, vector<double> &values, char *quantity);
+
+// adaptively sampled values along the line (zero outside the solution), lengths from the start
+void pyLineValues(vector<double> &start, vector<double> &end, int count, char *quantity, vector<double> &lengths, vector<double> &values);
+
+// values in the points for all time levels of the last solve, values of one point are stored contiguously
+void pyTimeHistory(vector<double> &x, vector<double> &y, vector<double> &z, vector<double> &times, vector<double> &values);
+
+// derived quantities
+void pyDerivedQuantity(char *name, char *expression);
+void pyRemoveDerivedQuantity(char *name);
+
+// integrals over the selected nodes (1 - line, 2 - surface, 3 - volume)
+void pyIntegrals(int dimension, vector<double> &values);
+
+// nodes of a generator (lattice, polar, cylindrical, line, circle, helix, plane, sphere) added at once,
+// returns number of added nodes
+int pyAddNodes(char *generator, vector<double> &parameters);
+
 #endif // PYTHONLABAGROS_H
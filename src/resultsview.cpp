@@ -20,11 +20,17 @@
 #include "resultsview.h"
 #include "scene.h"
 #include "field/problem.h"
+#include "field/localvalueprobe.h"
 #include <ctemplate/template.h>
 
+#include "style.tpl.varnames.h"
+#include "empty.tpl.varnames.h"
+#include "local_point_values.tpl.varnames.h"
+
 #include "util/constants.h"
 
-ResultsView::ResultsView(QWidget *parent): QDockWidget(tr("Results view"), parent)
+ResultsView::ResultsView(QWidget *parent): QDockWidget(tr("Results view"), parent),
+    m_sceneModePostprocessor(SceneModePostprocessor_LocalValue)
 {
     setMinimumWidth(280);
     setObjectName("ResultsView");
@@ -42,6 +48,12 @@ ResultsView::ResultsView(QWidget *parent): QDockWidget(tr("Results view"), paren
     widget->setLayout(layout);
 
     setWidget(widget);
+
+    m_probe = new LocalValueProbe(this);
+    connect(m_probe, SIGNAL(probed(LocalValueProbeResult)), this, SLOT(doProbed(LocalValueProbeResult)));
+
+    // redraw with every level of the progressive solve
+    connect(Util::problem(), SIGNAL(solutionRefined(int)), this, SLOT(doSolutionRefined(int)));
 }
 
 void ResultsView::createActions()
@@ -60,34 +72,109 @@ void ResultsView::doShowResults()
         showPoint();
 }
 
+void ResultsView::doSolutionRefined(int level)
+{
+    showPoint(m_point);
+}
+
+const std::string &ResultsView::styleSheet()
+{
+    // expanded again only when the font changes
+    QString font = QString("%1 %2").arg(QApplication::font().family()).arg(QApplication::font().pointSize());
+    if (font != m_styleSheetFont)
+    {
+        ctemplate::TemplateDictionary stylesheet("style");
+        stylesheet.SetValue(ks_FONTFAMILY, QApplication::font().family().toStdString());
+        stylesheet.SetValue(ks_FONTSIZE, (QString("%1").arg(QApplication::font().pointSize()).toStdString()));
+
+        m_styleSheet.clear();
+        ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/style.tpl", ctemplate::DO_NOT_STRIP, &stylesheet, &m_styleSheet);
+        m_styleSheetFont = font;
+    }
+
+    return m_styleSheet;
+}
+
 void ResultsView::showPoint(const Point &point)
 {
+    m_point = point;
+
     if (!Util::problem()->isSolved())
     {
         showEmpty();
         return;
     }
 
-    // stylesheet
-    std::string style;
-    ctemplate::TemplateDictionary stylesheet("style");
-    stylesheet.SetValue("FONTFAMILY", QApplication::font().family().toStdString());
-    stylesheet.SetValue("FONTSIZE", (QString("%1").arg(QApplication::font().pointSize()).toStdString()));
+    // evaluated off the GUI thread, shown by doProbed()
+    m_probe->probe(Point3(point.x, point.y, 0.0));
+}
 
-    ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/style.tpl", ctemplate::DO_NOT_STRIP, &stylesheet, &style);
+void ResultsView::doProbed(const LocalValueProbeResult &result)
+{
+    if (!Util::problem()->isSolved())
+        return;
+
+    showValues(result);
+}
+
+void ResultsView::showValues(const LocalValueProbeResult &result)
+{
+    const std::string &style = styleSheet();
+
+    QString pointX = QString("%1").arg(result.point.x, 0, 'e', 3);
+    QString pointY = QString("%1").arg(result.point.y, 0, 'e', 3);
+
+    // potential of the sources
+    bool showPotential = result.valid;
+    QString potential;
+    if (showPotential)
+        potential = QString("%1").arg(result.value, 0, 'e', 3);
+
+    // page with the same items is only patched
+    QString layout = QString("point|%1|%2").arg(m_styleSheetFont).arg(showPotential);
+    if (layout == m_layout)
+    {
+        QWebFrame *frame = webView->page()->mainFrame();
+        QWebElement elementX = frame->findFirstElement("#point_x");
+        QWebElement elementY = frame->findFirstElement("#point_y");
+        QWebElement elementPotential = frame->findFirstElement("#value_u");
+
+        if (!elementX.isNull() && !elementY.isNull() && (!showPotential || !elementPotential.isNull()))
+        {
+            elementX.setPlainText(pointX);
+            elementY.setPlainText(pointY);
+            if (showPotential)
+                elementPotential.setPlainText(potential);
+
+            return;
+        }
+    }
 
     // template
     std::string results;
     ctemplate::TemplateDictionary localPointValues("results");
 
-    localPointValues.SetValue("STYLESHEET", style);
-    localPointValues.SetValue("LABEL", tr("Local point values").toStdString());
+    localPointValues.SetValue(klpv_STYLESHEET, style);
+    localPointValues.SetValue(klpv_LABEL, tr("Local point values").toStdString());
 
-    localPointValues.SetValue("LABELX", Util::problem()->config()->labelX().toLower().toStdString());
-    localPointValues.SetValue("LABELY", Util::problem()->config()->labelY().toLower().toStdString());
-    localPointValues.SetValue("POINTX", (QString("%1").arg(point.x, 0, 'e', 3)).toStdString());
-    localPointValues.SetValue("POINTY", (QString("%1").arg(point.y, 0, 'e', 3)).toStdString());
-    localPointValues.SetValue("POINT_UNIT", "m");
+    localPointValues.SetValue(klpv_LABELX, Util::problem()->config()->labelX().toLower().toStdString());
+    localPointValues.SetValue(klpv_LABELY, Util::problem()->config()->labelY().toLower().toStdString());
+    localPointValues.SetValue(klpv_POINTX, pointX.toStdString());
+    localPointValues.SetValue(klpv_POINTY, pointY.toStdString());
+    localPointValues.SetValue(klpv_POINT_UNIT, "m");
+
+    if (showPotential)
+    {
+        ctemplate::TemplateDictionary *field = localPointValues.AddSectionDictionary(klpv_FIELD);
+        field->SetValue(klpv_FIELDNAME, tr("Field").toStdString());
+
+        ctemplate::TemplateDictionary *item = field->AddSectionDictionary(klpv_ITEM);
+        item->SetValue(klpv_ID, "u");
+        item->SetValue(klpv_NAME, tr("Potential").toStdString());
+        item->SetValue(klpv_SHORTNAME, "u");
+        item->SetValue(klpv_VALUE, potential.toStdString());
+        item->SetValue(klpv_UNIT, "-");
+    }
 
     /*
         LocalValue *value = Util::plugins()[fieldInfo->fieldId()]->localValue(fieldInfo, point);
@@ -135,28 +222,28 @@ void ResultsView::showPoint(const Point &point)
     // expand template
     ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/local_point_values.tpl", ctemplate::DO_NOT_STRIP, &localPointValues, &results);
     webView->setHtml(QString::fromStdString(results));
+    m_layout = layout;
 }
 
 void ResultsView::showEmpty()
 {
-    // stylesheet
-    std::string style;
-    ctemplate::TemplateDictionary stylesheet("style");
-    stylesheet.SetValue("FONTFAMILY", QApplication::font().family().toStdString());
-    stylesheet.SetValue("FONTSIZE", (QString("%1").arg(QApplication::font().pointSize()).toStdString()));
+    const std::string &style = styleSheet();
 
-    ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/style.tpl", ctemplate::DO_NOT_STRIP, &stylesheet, &style);
+    QString layout = QString("empty|%1").arg(m_styleSheetFont);
+    if (layout == m_layout)
+        return;
 
     // template
     std::string results;
     ctemplate::TemplateDictionary empty("empty");
 
-    empty.SetValue("STYLESHEET", style);
-    empty.SetValue("LABEL", tr("Problem is not solved.").toStdString());
+    empty.SetValue(ke_STYLESHEET, style);
+    empty.SetValue(ke_LABEL, tr("Problem is not solved.").toStdString());
 
     // expand template
     ctemplate::ExpandTemplate(datadir().toStdString() + TEMPLATEROOT.toStdString() + "/panels/empty.tpl", ctemplate::DO_NOT_STRIP, &empty, &results);
     webView->setHtml(QString::fromStdString(results));
+    m_layout = layout;
 }
 
 LocalPointValueDialog::LocalPointValueDialog(Point point, QWidget *parent) : QDialog(parent)
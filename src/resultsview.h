@@ -27,6 +27,8 @@
 class ValueLineEdit;
 class SceneMaterial;
 class Solution;
+class LocalValueProbe;
+struct LocalValueProbeResult;
 
 class ResultsView : public QDockWidget
 {
@@ -39,6 +41,10 @@ public slots:
     void showEmpty();
     void showPoint(const Point &m_point = Point());
 
+private slots:
+    void doSolutionRefined(int level);
+    void doProbed(const LocalValueProbeResult &result);
+
 public:
     ResultsView(QWidget *parent = 0);
 
@@ -46,11 +52,22 @@ public:
 
 private:
     SceneModePostprocessor m_sceneModePostprocessor;
+    Point m_point;
 
     QAction *actPoint;
     QWebView *webView;
 
+    LocalValueProbe *m_probe;
+
+    // expanded stylesheet and the font it belongs to
+    std::string m_styleSheet;
+    QString m_styleSheetFont;
+    // items of the shown page, values of the same layout are patched in the DOM
+    QString m_layout;
+
     void createActions();
+    const std::string &styleSheet();
+    void showValues(const LocalValueProbeResult &result);
 };
 
 class LocalPointValueDialog : public QDialog
@@ -29,6 +29,7 @@
 #include "field/problem.h"
 #include "problemdialog.h"
 #include "scenetransformdialog.h"
+#include "util/spatialhash.h"
 
 #include "pythonlabagros.h"
 
@@ -41,7 +42,7 @@ Util::Util()
 {
     m_problem = new Problem();
     m_scene = new Scene();
-    QObject::connect(m_scene, SIGNAL(invalidated()), m_problem, SLOT(clearSolution()));
+    QObject::connect(m_scene, SIGNAL(invalidated()), m_problem, SLOT(doSceneInvalidated()));
 
     initLists();
 
@@ -74,11 +75,13 @@ Util *Util::singleton()
 
 // ************************************************************************************************************************
 
-Scene::Scene()
+Scene::Scene() : m_transactions(0), m_isInvalidated(false), m_isValidationChanged(true)
 {
     createActions();
 
     m_undoStack = new QUndoStack(this);
+    m_undoStack->setUndoLimit(UNDOLIMIT);
+    connect(m_undoStack, SIGNAL(indexChanged(int)), this, SLOT(doUndoStackChanged()));
 
     connect(this, SIGNAL(invalidated()), this, SLOT(doInvalidated()));
 
@@ -108,6 +111,10 @@ void Scene::createActions()
     actDeleteSelected->setStatusTip(tr("Delete selected objects"));
     connect(actDeleteSelected, SIGNAL(triggered()), this, SLOT(doDeleteSelected()));
 
+    actMergeDuplicates = new QAction(tr("&Merge duplicate nodes"), this);
+    actMergeDuplicates->setStatusTip(tr("Merge nodes closer than the tolerance"));
+    connect(actMergeDuplicates, SIGNAL(triggered()), this, SLOT(doMergeDuplicates()));
+
     actTransform = new QAction(icon("scene-transform"), tr("&Transform"), this);
     actTransform->setStatusTip(tr("Transform"));
 }
@@ -122,11 +129,48 @@ SceneNode *Scene::addNode(SceneNode *node)
     }
 
     nodes->add(node);
-    if (!currentPythonEngine()->isRunning()) emit invalidated();
+    if (!currentPythonEngine()->isRunning()) invalidate();
 
     return node;
 }
 
+int Scene::addNodes(const QVector<Point3> &points, const QString &name)
+{
+    if (points.isEmpty())
+        return 0;
+
+    // box of the existing and new nodes for the cells of the spatial hash
+    CubePoint box(points.first(), points.first());
+    if (!nodes->isEmpty())
+        box = nodes->boundingBox();
+    foreach (Point3 point, points)
+    {
+        box.start = Point3(qMin(box.start.x, point.x), qMin(box.start.y, point.y), qMin(box.start.z, point.z));
+        box.end = Point3(qMax(box.end.x, point.x), qMax(box.end.y, point.y), qMax(box.end.z, point.z));
+    }
+
+    const QList<SceneNode *> items = nodes->items();
+    SpatialHash hash(SpatialHash::cellSize(box, items.count() + points.count()));
+    foreach (SceneNode *node, items)
+        hash.insert(node->point(), node->id());
+
+    QVector<Point3> pointsNew;
+    pointsNew.reserve(points.count());
+    foreach (Point3 point, points)
+    {
+        if (hash.find(point) != -1)
+            continue;
+
+        hash.insert(point, 0);
+        pointsNew.append(point);
+    }
+
+    if (!pointsNew.isEmpty())
+        m_undoStack->push(new SceneNodeCommandAddMulti(pointsNew, name));
+
+    return pointsNew.count();
+}
+
 void Scene::removeNode(SceneNode *node)
 {
     nodes->remove(node);
@@ -135,7 +179,7 @@ void Scene::removeNode(SceneNode *node)
     nodes->items().removeOne(node);
     // delete node;
 
-    emit invalidated();
+    invalidate();
 }
 
 SceneNode *Scene::getNode(const Point3 &point)
@@ -152,12 +196,47 @@ void Scene::clear()
     // geometry
     nodes->clear();
 
+    m_snapshot = SceneSnapshot();
+    m_snapshotChanged.clear();
+
+    m_validation = SceneValidation();
+    m_isValidationChanged = true;
+
     blockSignals(false);
 
     emit cleared();
 
     emit fileNameChanged(tr("unnamed"));
-    emit invalidated();
+    invalidate();
+}
+
+void Scene::beginTransaction()
+{
+    m_transactions++;
+}
+
+void Scene::commitTransaction()
+{
+    assert(m_transactions > 0);
+
+    if (--m_transactions > 0)
+        return;
+
+    SceneChangeSet changes = nodes->takeChanges();
+    bool isInvalidated = m_isInvalidated || changes.isGeometryChanged();
+    m_isInvalidated = false;
+
+    m_snapshotChanged.unite(changes.added);
+    m_snapshotChanged.unite(changes.removed);
+    m_snapshotChanged.unite(changes.moved);
+
+    if (changes.isGeometryChanged())
+        m_isValidationChanged = true;
+
+    if (!changes.isEmpty())
+        emit changed(changes);
+    if (isInvalidated)
+        emit invalidated();
 }
 
 CubePoint Scene::boundingBox() const
@@ -175,13 +254,61 @@ CubePoint Scene::boundingBox() const
     }
 }
 
+SceneSnapshot Scene::snapshot()
+{
+    // committed changes and changes of an open transaction
+    SceneBitSet changed = m_snapshotChanged;
+    changed.unite(nodes->changes().added);
+    changed.unite(nodes->changes().removed);
+    changed.unite(nodes->changes().moved);
+
+    if (!changed.isEmpty())
+    {
+        m_snapshot = SceneSnapshot(m_snapshot, nodes, changed);
+        m_snapshotChanged.clear();
+    }
+
+    return m_snapshot;
+}
+
+const SceneValidation &Scene::validation()
+{
+    if (m_isValidationChanged || m_validation.tolerance() != Util::config()->geometryTolerance)
+    {
+        m_validation = SceneValidation(snapshot(), Util::config()->geometryTolerance);
+        m_isValidationChanged = false;
+    }
+
+    return m_validation;
+}
+
+int Scene::mergeDuplicates()
+{
+    const SceneBitSet &duplicates = validation().duplicates();
+    if (duplicates.isEmpty())
+        return 0;
+
+    QList<SceneNode *> removed;
+    for (int id = duplicates.next(0); id != -1; id = duplicates.next(id + 1))
+        removed.append(nodes->find(id));
+
+    // one bulk command, the scene is invalidated by the command
+    m_undoStack->push(SceneNode::getRemoveCommand(removed, tr("Merge duplicate nodes")));
+
+    return removed.count();
+}
+
 void Scene::selectNone()
 {
+    beginTransaction();
     nodes->setSelected(false);
+    commitTransaction();
 }
 
 void Scene::selectAll(SceneGeometryMode sceneMode)
 {
+    beginTransaction();
+
     selectNone();
 
     switch (sceneMode)
@@ -190,77 +317,214 @@ void Scene::selectAll(SceneGeometryMode sceneMode)
         nodes->setSelected();
         break;
     }
+
+    commitTransaction();
 }
 
 void Scene::deleteSelected()
 {
-    m_undoStack->beginMacro(tr("Delete selected"));
-
-    nodes->selected().deleteWithUndo(tr("Remove node"));
-
-    m_undoStack->endMacro();
-
-    emit invalidated();
+    // one bulk command, the scene is invalidated by the command
+    nodes->selected().deleteWithUndo(tr("Delete selected"));
 }
 
 int Scene::selectedCount()
 {
-    return nodes->selected().length();
+    return nodes->selectedCount();
 }
 
 void Scene::highlightNone()
 {
+    beginTransaction();
     nodes->setHighlighted(false);
+    commitTransaction();
 }
 
 int Scene::highlightedCount()
 {
-    return nodes->highlighted().length();
+    return nodes->highlightedCount();
 }
 
 
 void Scene::transformTranslate(const Point3 &point, bool copy)
 {
-    m_undoStack->beginMacro(tr("Translation"));
+    double matrix[3][4] = {{1.0, 0.0, 0.0, point.x},
+                           {0.0, 1.0, 0.0, point.y},
+                           {0.0, 0.0, 1.0, point.z}};
 
-    // TODO
-
-    m_undoStack->endMacro();
-    emit invalidated();
+    transform(matrix, copy, tr("Translation"));
 }
 
 void Scene::transformRotateXY(const Point &point, double angle, bool copy)
 {
-    m_undoStack->beginMacro(tr("Rotation"));
+    double c = cos(angle / 180.0 * M_PI);
+    double s = sin(angle / 180.0 * M_PI);
 
-    // TODO
+    double matrix[3][4] = {{c, -s, 0.0, point.x - c * point.x + s * point.y},
+                           {s, c, 0.0, point.y - s * point.x - c * point.y},
+                           {0.0, 0.0, 1.0, 0.0}};
 
-    m_undoStack->endMacro();
-    emit invalidated();
+    transform(matrix, copy, tr("Rotation"));
+}
+
+void Scene::transformRotateYZ(const Point &point, double angle, bool copy)
+{
+    double c = cos(angle / 180.0 * M_PI);
+    double s = sin(angle / 180.0 * M_PI);
+
+    double matrix[3][4] = {{1.0, 0.0, 0.0, 0.0},
+                           {0.0, c, -s, point.x - c * point.x + s * point.y},
+                           {0.0, s, c, point.y - s * point.x - c * point.y}};
+
+    transform(matrix, copy, tr("Rotation"));
+}
+
+void Scene::transformRotateZX(const Point &point, double angle, bool copy)
+{
+    double c = cos(angle / 180.0 * M_PI);
+    double s = sin(angle / 180.0 * M_PI);
+
+    double matrix[3][4] = {{c, 0.0, s, point.y - c * point.y - s * point.x},
+                           {0.0, 1.0, 0.0, 0.0},
+                           {-s, 0.0, c, point.x + s * point.y - c * point.x}};
+
+    transform(matrix, copy, tr("Rotation"));
 }
 
 void Scene::transformScale(const Point3 &point, double scaleFactor, bool copy)
 {
-    m_undoStack->beginMacro(tr("Scale"));
+    double matrix[3][4] = {{scaleFactor, 0.0, 0.0, point.x * (1.0 - scaleFactor)},
+                           {0.0, scaleFactor, 0.0, point.y * (1.0 - scaleFactor)},
+                           {0.0, 0.0, scaleFactor, point.z * (1.0 - scaleFactor)}};
+
+    transform(matrix, copy, tr("Scale"));
+}
+
+void Scene::transform(const double matrix[3][4], bool copy, const QString &name)
+{
+    // coordinates of the selected nodes as separate arrays
+    QVector<int> ids;
+    QVector<Point3> points;
+    QVector<double> x, y, z;
+
+    const SceneBitSet &selection = nodes->selection();
+    if (selection.isEmpty())
+        return;
+
+    ids.reserve(selection.count());
+    points.reserve(selection.count());
+    x.reserve(selection.count());
+    y.reserve(selection.count());
+    z.reserve(selection.count());
+    for (int id = selection.next(0); id != -1; id = selection.next(id + 1))
+    {
+        Point3 point = nodes->find(id)->point();
 
-    // TODO
+        ids.append(id);
+        points.append(point);
+        x.append(point.x);
+        y.append(point.y);
+        z.append(point.z);
+    }
 
-    m_undoStack->endMacro();
+    // independent rows, the loop is vectorized by the compiler
+    int count = ids.count();
+    QVector<double> xNew(count), yNew(count), zNew(count);
+    const double *px = x.constData(), *py = y.constData(), *pz = z.constData();
+    double *qx = xNew.data(), *qy = yNew.data(), *qz = zNew.data();
 
-    emit invalidated();
+    double m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2], m03 = matrix[0][3];
+    double m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2], m13 = matrix[1][3];
+    double m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2], m23 = matrix[2][3];
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+    {
+        qx[i] = m00 * px[i] + m01 * py[i] + m02 * pz[i] + m03;
+        qy[i] = m10 * px[i] + m11 * py[i] + m12 * pz[i] + m13;
+        qz[i] = m20 * px[i] + m21 * py[i] + m22 * pz[i] + m23;
+    }
+
+    // nodes which stay in place (all of them when copying) and transformed nodes in a spatial hash,
+    // a transformed node must not coincide with any of them
+    const QList<SceneNode *> items = nodes->items();
+    SpatialHash hash(SpatialHash::cellSize(boundingBox(), items.count() + count));
+    foreach (SceneNode *node, items)
+        if (copy || !node->isSelected())
+            hash.insert(node->point(), node->id());
+
+    QVector<Point3> pointsNew;
+    pointsNew.reserve(count);
+    for (int i = 0; i < count; i++)
+    {
+        Point3 point(qx[i], qy[i], qz[i]);
+
+        if (hash.find(point) != -1)
+        {
+            // copy is skipped, moved node would be merged
+            if (copy)
+                continue;
+
+            Util::log()->printWarning(tr("Geometry"), tr("%1: node would coincide with an existing node.").arg(name));
+            return;
+        }
+
+        hash.insert(point, ids[i]);
+        pointsNew.append(point);
+    }
+
+    if (copy)
+    {
+        if (!pointsNew.isEmpty())
+            m_undoStack->push(new SceneNodeCommandAddMulti(pointsNew, name));
+    }
+    else
+    {
+        m_undoStack->push(new SceneNodeCommandEditMulti(ids, points, pointsNew, name));
+    }
 }
 
 void Scene::doInvalidated()
 {
 }
 
+/// bulk commands of the command and its children (macro)
+static void sceneBulkCommands(const QUndoCommand *command, QList<SceneNodeCommandMulti *> &commands)
+{
+    // commands are owned by the stack, only their payload is compacted
+    SceneNodeCommandMulti *bulk = dynamic_cast<SceneNodeCommandMulti *>(const_cast<QUndoCommand *>(command));
+    if (bulk)
+        commands.append(bulk);
+
+    for (int i = 0; i < command->childCount(); i++)
+        sceneBulkCommands(command->child(i), commands);
+}
+
+void Scene::doUndoStackChanged()
+{
+    // newest commands are kept as they are up to the memory budget, payload of the older ones is compressed
+    int memory = 0;
+    for (int i = m_undoStack->count() - 1; i >= 0; i--)
+    {
+        QList<SceneNodeCommandMulti *> commands;
+        sceneBulkCommands(m_undoStack->command(i), commands);
+
+        foreach (SceneNodeCommandMulti *command, commands)
+        {
+            if (memory + command->memory() > UNDOMEMORYBUDGET)
+                command->compact();
+
+            memory += command->memory();
+        }
+    }
+}
+
 void Scene::doNewNode(const Point3 &point)
 {
     SceneNode *node = new SceneNode(point);
     if (node->showDialog(QApplication::activeWindow(), true) == QDialog::Accepted)
     {
         SceneNode *nodeAdded = addNode(node);
-        if (nodeAdded == node) m_undoStack->push(new SceneNodeCommandAdd(node->point()));
+        if (nodeAdded == node) m_undoStack->push(new SceneNodeCommandAdd(node->point(), node->id()));
     }
     else
         delete node;
@@ -271,6 +535,13 @@ void Scene::doDeleteSelected()
     deleteSelected();
 }
 
+void Scene::doMergeDuplicates()
+{
+    int count = mergeDuplicates();
+    Util::log()->printMessage(tr("Geometry"), tr("%1 duplicate nodes merged (tolerance %2 m).").
+                              arg(count).arg(Util::config()->geometryTolerance));
+}
+
 ErrorResult Scene::readFromFile(const QString &fileName)
 {
     QSettings settings;
@@ -390,9 +661,14 @@ ErrorResult Scene::readFromFile(const QString &fileName)
     blockSignals(false);
 
     // default values
-    emit invalidated();
+    invalidate();
     emit defaultValues();
 
+    const SceneValidation &validation = this->validation();
+    if (!validation.isValid())
+        Util::log()->printWarning(tr("Geometry"), tr("%1 duplicate nodes (tolerance %2 m) and %3 nodes with invalid coordinates.").
+                                  arg(validation.duplicates().count()).arg(validation.tolerance()).arg(validation.invalid().count()));
+
     // mesh
     if (eleDoc.elementsByTagName("mesh").count() > 0)
     {
@@ -22,6 +22,9 @@
 
 #include "util.h"
 #include "conf.h"
+#include "scenebasic.h"
+#include "scenesnapshot.h"
+#include "scenevalidation.h"
 
 class Problem;
 
@@ -45,11 +48,15 @@ class Scene : public QObject
 public slots:
     void doNewNode(const Point3 &point = Point3());
     void doDeleteSelected();
+    void doMergeDuplicates();
 
 signals:
     void invalidated();
     void cleared();
 
+    /// emitted once per (outermost) transaction with the ids of changed items, before invalidated()
+    void changed(const SceneChangeSet &changes);
+
     void defaultValues();
     void fileNameChanged(const QString &fileName);
 
@@ -61,17 +68,30 @@ public:
 
     QAction *actNewNode;
     QAction *actDeleteSelected;
+    QAction *actMergeDuplicates;
 
     QAction *actTransform;
 
     void clear();
 
     SceneNode *addNode(SceneNode *node);
+    /// adds nodes at once with one undo command (one change set), points coincident with existing nodes
+    /// or with each other are skipped, returns number of added nodes
+    int addNodes(const QVector<Point3> &points, const QString &name);
     void removeNode(SceneNode *node);
     SceneNode *getNode(const Point3 &point);
 
     CubePoint boundingBox() const;
 
+    /// current geometry as an immutable snapshot, only chunks changed since the previous call are rebuilt
+    SceneSnapshot snapshot();
+
+    /// validation of the current geometry with the tolerance of the configuration,
+    /// kept until the next change of the geometry (or of the tolerance)
+    const SceneValidation &validation();
+    /// removes duplicate nodes (kept nodes stay in place) with one undo command, returns number of removed nodes
+    int mergeDuplicates();
+
     void selectNone();
     void selectAll(SceneGeometryMode sceneMode);
     int selectedCount();
@@ -80,13 +100,22 @@ public:
     void highlightNone();
     int highlightedCount();
 
+    /// transforms selected nodes (or their copies) with one undo command,
+    /// rotations are in degrees around the base point in the plane (XY: x, y; YZ: y, z; ZX: z, x)
     void transformTranslate(const Point3 &point, bool copy);
     void transformRotateXY(const Point &point, double angle, bool copy);
-    void transformRotateYZ(const Point &point, double angle, bool copy) {} // TODO
-    void transformRotateZX(const Point &point, double angle, bool copy) {} // TODO
+    void transformRotateYZ(const Point &point, double angle, bool copy);
+    void transformRotateZX(const Point &point, double angle, bool copy);
     void transformScale(const Point3 &point, double scaleFactor, bool copy);
 
-    inline void invalidate() { emit invalidated(); }
+    /// changes made between begin and commit are notified at once by changed() and (if the geometry changed)
+    /// invalidated() when the outermost transaction is committed, transactions can be nested
+    void beginTransaction();
+    void commitTransaction();
+    inline bool isInTransaction() const { return m_transactions > 0; }
+
+    /// notifies changes (deferred to the commit inside a transaction), invalidated() is always emitted
+    inline void invalidate() { beginTransaction(); m_isInvalidated = true; commitTransaction(); }
 
     ErrorResult readFromFile(const QString &fileName);
     ErrorResult writeToFile(const QString &fileName);
@@ -96,10 +125,24 @@ public:
 private:
     QUndoStack *m_undoStack;
 
+    int m_transactions;
+    bool m_isInvalidated;
+
+    SceneSnapshot m_snapshot;
+    /// ids with geometry changed (committed) since m_snapshot was taken
+    SceneBitSet m_snapshotChanged;
+
+    SceneValidation m_validation;
+    bool m_isValidationChanged;
+
     void createActions();
 
+    /// affine transform of the selected nodes, rows of the matrix are x, y, z (three coefficients and offset)
+    void transform(const double matrix[3][4], bool copy, const QString &name);
+
 private slots:
     void doInvalidated();
+    void doUndoStackChanged();
 };
 
 // **************************************************************************************
@@ -25,10 +25,186 @@
 
 #include "field/problem.h"
 
+static inline int popCount(quint64 word)
+{
+    word = word - ((word >> 1) & Q_UINT64_C(0x5555555555555555));
+    word = (word & Q_UINT64_C(0x3333333333333333)) + ((word >> 2) & Q_UINT64_C(0x3333333333333333));
+    word = (word + (word >> 4)) & Q_UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return (word * Q_UINT64_C(0x0101010101010101)) >> 56;
+}
+
+void SceneBitSet::insert(int id)
+{
+    int word = id >> 6;
+    if (word >= m_words.count())
+        m_words.resize(word + 1);
+
+    quint64 bit = Q_UINT64_C(1) << (id & 63);
+    if (!(m_words[word] & bit))
+    {
+        m_words[word] |= bit;
+        m_count++;
+    }
+}
+
+void SceneBitSet::remove(int id)
+{
+    int word = id >> 6;
+    if (word >= m_words.count())
+        return;
+
+    quint64 bit = Q_UINT64_C(1) << (id & 63);
+    if (m_words[word] & bit)
+    {
+        m_words[word] &= ~bit;
+        m_count--;
+    }
+}
+
+void SceneBitSet::clear()
+{
+    m_words.clear();
+    m_count = 0;
+}
+
+int SceneBitSet::next(int id) const
+{
+    int word = id >> 6;
+    if (word >= m_words.count())
+        return -1;
+
+    // bits below id are masked out in the first word
+    quint64 bits = m_words[word] & (~Q_UINT64_C(0) << (id & 63));
+    while (!bits)
+    {
+        if (++word == m_words.count())
+            return -1;
+        bits = m_words[word];
+    }
+
+    // index of the lowest set bit
+    return (word << 6) + popCount((bits & (~bits + 1)) - 1);
+}
+
+void SceneBitSet::unite(const SceneBitSet &set)
+{
+    if (m_words.count() < set.m_words.count())
+        m_words.resize(set.m_words.count());
+
+    for (int i = 0; i < set.m_words.count(); i++)
+        m_words[i] |= set.m_words[i];
+
+    recount();
+}
+
+void SceneBitSet::intersect(const SceneBitSet &set)
+{
+    if (m_words.count() > set.m_words.count())
+        m_words.resize(set.m_words.count());
+
+    for (int i = 0; i < m_words.count(); i++)
+        m_words[i] &= set.m_words[i];
+
+    recount();
+}
+
+void SceneBitSet::subtract(const SceneBitSet &set)
+{
+    for (int i = 0; i < qMin(m_words.count(), set.m_words.count()); i++)
+        m_words[i] &= ~set.m_words[i];
+
+    recount();
+}
+
+void SceneBitSet::invert(const SceneBitSet &all)
+{
+    m_words.resize(all.m_words.count());
+
+    for (int i = 0; i < m_words.count(); i++)
+        m_words[i] = ~m_words[i] & all.m_words[i];
+
+    recount();
+}
+
+void SceneBitSet::recount()
+{
+    m_count = 0;
+    for (int i = 0; i < m_words.count(); i++)
+        m_count += popCount(m_words[i]);
+}
+
+// *************************************************************************************************************************************
+
+void SceneChangeSet::add(int id)
+{
+    if (removed.contains(id))
+    {
+        removed.remove(id);
+        moved.insert(id);
+    }
+    else
+    {
+        added.insert(id);
+    }
+}
+
+void SceneChangeSet::remove(int id)
+{
+    moved.remove(id);
+    selection.remove(id);
+
+    if (added.contains(id))
+        added.remove(id);
+    else
+        removed.insert(id);
+}
+
+void SceneChangeSet::move(int id)
+{
+    if (!added.contains(id))
+        moved.insert(id);
+}
+
+void SceneChangeSet::select(int id)
+{
+    if (!added.contains(id))
+        selection.insert(id);
+}
+
+void SceneChangeSet::clear()
+{
+    added.clear();
+    removed.clear();
+    moved.clear();
+    selection.clear();
+}
+
+// *************************************************************************************************************************************
+
 SceneBasic::SceneBasic()
 {
-    setSelected(false);
-    m_isHighlighted = false;
+    m_id = 0;
+    m_selection = NULL;
+    m_highlight = NULL;
+    m_changes = NULL;
+}
+
+void SceneBasic::setSelected(bool value)
+{
+    if (m_selection && m_selection->contains(m_id) != value)
+    {
+        m_selection->set(m_id, value);
+        m_changes->select(m_id);
+    }
+}
+
+void SceneBasic::setHighlighted(bool value)
+{
+    if (m_highlight && m_highlight->contains(m_id) != value)
+    {
+        m_highlight->set(m_id, value);
+        m_changes->select(m_id);
+    }
 }
 
 QVariant SceneBasic::variant()
@@ -45,14 +221,50 @@ bool SceneBasicContainer<BasicType>::add(BasicType *item)
 {
     //TODO add check
     data.append(item);
+    addId(item);
 
     return true;
 }
 
+template <typename BasicType>
+void SceneBasicContainer<BasicType>::addId(BasicType *item)
+{
+    if (item->id() == 0)
+        item->setId(++m_lastId);
+    else
+        m_lastId = qMax(m_lastId, item->id());
+
+    m_items[item->id()] = item;
+    m_ids.insert(item->id());
+    m_changes.add(item->id());
+
+    item->m_selection = &m_selection;
+    item->m_highlight = &m_highlight;
+    item->m_changes = &m_changes;
+}
+
+template <typename BasicType>
+void SceneBasicContainer<BasicType>::removeId(BasicType *item)
+{
+    m_items.remove(item->id());
+    m_ids.remove(item->id());
+    m_selection.remove(item->id());
+    m_highlight.remove(item->id());
+    m_changes.remove(item->id());
+
+    item->m_selection = NULL;
+    item->m_highlight = NULL;
+    item->m_changes = NULL;
+}
+
 template <typename BasicType>
 bool SceneBasicContainer<BasicType>::remove(BasicType *item)
 {
-    return data.removeOne(item);
+    if (!data.removeOne(item))
+        return false;
+
+    removeId(item);
+    return true;
 }
 
 template <typename BasicType>
@@ -68,32 +280,132 @@ void SceneBasicContainer<BasicType>::clear()
         delete item;
 
     data.clear();
+    m_items.clear();
+    m_lastId = 0;
+
+    m_ids.clear();
+    m_selection.clear();
+    m_highlight.clear();
+    m_changes.clear();
+}
+
+template <typename BasicType>
+QList<BasicType*> SceneBasicContainer<BasicType>::removeAt(const QVector<int> &indices)
+{
+    QList<BasicType*> removed;
+    QList<BasicType*> kept;
+    kept.reserve(data.count());
+
+    int next = 0;
+    for (int i = 0; i < data.count(); i++)
+    {
+        if (next < indices.count() && indices[next] == i)
+        {
+            removed.append(data[i]);
+            removeId(data[i]);
+            next++;
+        }
+        else
+        {
+            kept.append(data[i]);
+        }
+    }
+
+    data = kept;
+
+    return removed;
+}
+
+template <typename BasicType>
+void SceneBasicContainer<BasicType>::insertAt(const QVector<int> &indices, const QList<BasicType*> &items)
+{
+    assert(indices.count() == items.count());
+
+    QList<BasicType*> merged;
+    merged.reserve(data.count() + items.count());
+
+    int next = 0;
+    int source = 0;
+    while (next < items.count() || source < data.count())
+    {
+        if (next < items.count() && (indices[next] <= merged.count() || source == data.count()))
+        {
+            addId(items[next]);
+            merged.append(items[next++]);
+        }
+        else
+        {
+            merged.append(data[source++]);
+        }
+    }
+
+    data = merged;
 }
 
 template <typename BasicType>
 void SceneBasicContainer<BasicType>::setSelected(bool value)
 {
-    foreach (BasicType* item, data)
-        item->setSelected(value);
+    // items selected before or after the change
+    m_changes.selection.unite(m_selection);
+
+    if (value)
+        m_selection = m_ids;
+    else
+        m_selection.clear();
+
+    m_changes.selection.unite(m_selection);
 }
 
 template <typename BasicType>
 void SceneBasicContainer<BasicType>::setHighlighted(bool value)
 {
-    foreach (BasicType* item, data)
-        item->setHighlighted(value);
+    m_changes.selection.unite(m_highlight);
+
+    if (value)
+        m_highlight = m_ids;
+    else
+        m_highlight.clear();
+
+    m_changes.selection.unite(m_highlight);
+}
+
+template <typename BasicType>
+void SceneBasicContainer<BasicType>::setSelection(const SceneBitSet &selection)
+{
+    m_changes.selection.unite(m_selection);
+
+    m_selection = selection;
+    m_selection.intersect(m_ids);
+
+    m_changes.selection.unite(m_selection);
+}
+
+template <typename BasicType>
+void SceneBasicContainer<BasicType>::invertSelection()
+{
+    // every item changes
+    m_selection.invert(m_ids);
+    m_changes.selection.unite(m_ids);
+}
+
+template <typename BasicType>
+SceneChangeSet SceneBasicContainer<BasicType>::takeChanges()
+{
+    SceneChangeSet changes = m_changes;
+    m_changes.clear();
+
+    return changes;
 }
 
 template <typename BasicType>
 void SceneBasicContainer<BasicType>::deleteWithUndo(QString message)
 {
-    foreach (BasicType *node, data)
-    {
-        Util::scene()->undoStack()->beginMacro(message);
-        Util::scene()->undoStack()->push(node->getRemoveCommand());
-        this->remove(node);
-        Util::scene()->undoStack()->endMacro();
-    }
+    if (data.isEmpty())
+        return;
+
+    // one command removes all items in one pass (and invalidates the scene once)
+    Util::scene()->undoStack()->push(BasicType::getRemoveCommand(data, message));
+    data.clear();
 }
 
 template class SceneBasicContainer<SceneNode>;
@@ -33,31 +33,105 @@ class SceneNode;
 Q_DECLARE_METATYPE(SceneBasic *)
 Q_DECLARE_METATYPE(SceneNode *)
 
+/// dense set of item ids (one bit per id) with maintained count
+class SceneBitSet
+{
+public:
+    SceneBitSet() : m_count(0) {}
+
+    inline bool contains(int id) const
+    {
+        return ((id >> 6) < m_words.count()) && (m_words[id >> 6] & (Q_UINT64_C(1) << (id & 63)));
+    }
+    void insert(int id);
+    void remove(int id);
+    inline void set(int id, bool value) { if (value) insert(id); else remove(id); }
+
+    inline int count() const { return m_count; }
+    inline bool isEmpty() const { return m_count == 0; }
+    void clear();
+
+    /// first id in the set not less than id or -1,
+    /// iteration: for (int id = set.next(0); id != -1; id = set.next(id + 1))
+    int next(int id) const;
+
+    /// set operations, word by word
+    void unite(const SceneBitSet &set);
+    void intersect(const SceneBitSet &set);
+    void subtract(const SceneBitSet &set);
+    /// complement with respect to the given set (all ids of a container)
+    void invert(const SceneBitSet &all);
+
+private:
+    QVector<quint64> m_words;
+    int m_count;
+
+    void recount();
+};
+
+/// ids of items changed since the last notification by the kind of change,
+/// an item added and removed again is not reported, a removed item added again is reported as moved
+struct SceneChangeSet
+{
+    SceneBitSet added;
+    SceneBitSet removed;
+    SceneBitSet moved;
+    /// selection or highlight changed
+    SceneBitSet selection;
+
+    void add(int id);
+    void remove(int id);
+    void move(int id);
+    void select(int id);
+
+    inline bool isGeometryChanged() const { return !(added.isEmpty() && removed.isEmpty() && moved.isEmpty()); }
+    inline bool isEmpty() const { return !isGeometryChanged() && selection.isEmpty(); }
+    void clear();
+};
+
 class SceneBasic 
 {
 
 public:
     SceneBasic();
 
-    void setSelected(bool value = true) { m_isSelected = value; }
-    inline bool isSelected() const { return m_isSelected; }
+    /// selection and highlight are kept in sets of the container the item belongs to
+    /// (an item which is not in a container is neither selected nor highlighted)
+    void setSelected(bool value = true);
+    inline bool isSelected() const { return m_selection && m_selection->contains(m_id); }
+
+    void setHighlighted(bool value = true);
+    inline bool isHighlighted() const { return m_highlight && m_highlight->contains(m_id); }
 
-    void setHighlighted(bool value = true) { m_isHighlighted = value; }
-    inline bool isHighlighted() const { return m_isHighlighted; }
+    /// stable handle assigned by the container (0 before the item is added),
+    /// undo commands refer to items by it
+    inline int id() const { return m_id; }
+    inline void setId(int id) { m_id = id; }
 
     virtual int showDialog(QWidget *parent, bool isNew = false) = 0;
 
     QVariant variant();
 
+protected:
+    /// records change of the geometry of the item
+    inline void moved() { if (m_changes) m_changes->move(m_id); }
+
 private:
-    bool m_isSelected;
-    bool m_isHighlighted;
+    int m_id;
+
+    SceneBitSet *m_selection;
+    SceneBitSet *m_highlight;
+    SceneChangeSet *m_changes;
+
+    template <typename BasicType> friend class SceneBasicContainer;
 };
 
 template <typename BasicType>
 class SceneBasicContainer
 {
 public:
+    SceneBasicContainer() : m_lastId(0) {}
+
     /// items() should be removed step by step from the code.
     /// more methods operating with list data should be defined here
     QList<BasicType*> items() { return data; }
@@ -65,23 +139,68 @@ public:
     bool add(BasicType *item);
     virtual bool remove(BasicType *item);
     BasicType *at(int i);
+    /// item with the given id or NULL, O(1)
+    inline BasicType *find(int id) const { return m_items.value(id, NULL); }
     inline int length() { return data.length(); }
     inline int count() {return length(); }
     inline int isEmpty() { return data.isEmpty(); }
     void clear();
 
-    /// selects or unselects all items
+    /// position of the item in the container or -1
+    inline int indexOf(BasicType *item) const { return data.indexOf(item); }
+
+    /// removes items at the positions (ascending) in one pass, removed items are returned, not deleted
+    QList<BasicType*> removeAt(const QVector<int> &indices);
+
+    /// inserts items so that they end at the positions (ascending) in one pass,
+    /// inverse of removeAt()
+    void insertAt(const QVector<int> &indices, const QList<BasicType*> &items);
+
+    /// selects or unselects all items, O(N / 64)
     void setSelected(bool value = true);
 
-    /// highlights or unhighlights all items
+    /// highlights or unhighlights all items, O(N / 64)
     void setHighlighted(bool value = true);
 
+    /// ids of all, selected and highlighted items
+    inline const SceneBitSet &ids() const { return m_ids; }
+    inline const SceneBitSet &selection() const { return m_selection; }
+    inline const SceneBitSet &highlight() const { return m_highlight; }
+
+    /// replaces the selection (unknown ids are ignored)
+    void setSelection(const SceneBitSet &selection);
+    void invertSelection();
+
+    inline int selectedCount() const { return m_selection.count(); }
+    inline int highlightedCount() const { return m_highlight.count(); }
+
+    /// changes since the last call, the record is cleared
+    SceneChangeSet takeChanges();
+    /// changes not taken yet
+    inline const SceneChangeSet &changes() const { return m_changes; }
+
+    /// removes all items of the container from the scene with one undo command
     void deleteWithUndo(QString message);
 
 protected:
     QList<BasicType*> data;
 
     QString containerName;
+
+private:
+    QHash<int, BasicType*> m_items;
+    int m_lastId;
+
+    SceneBitSet m_ids;
+    SceneBitSet m_selection;
+    SceneBitSet m_highlight;
+
+    SceneChangeSet m_changes;
+
+    /// assigns id to a new item (items restored by undo keep theirs) and attaches it to the sets
+    void addId(BasicType *item);
+    /// detaches removed item
+    void removeId(BasicType *item);
 };
 
 
@@ -39,7 +39,33 @@ int SceneNode::showDialog(QWidget *parent, bool isNew)
 
 SceneNodeCommandRemove* SceneNode::getRemoveCommand()
 {
-    return new SceneNodeCommandRemove(this->point());
+    return new SceneNodeCommandRemove(this->point(), this->id());
+}
+
+SceneNodeCommandRemoveMulti* SceneNode::getRemoveCommand(const QList<SceneNode *> &nodes, const QString &text)
+{
+    QSet<SceneNode *> removed = QSet<SceneNode *>::fromList(nodes);
+
+    // positions in the scene container (ascending)
+    QVector<int> ids;
+    QVector<int> indices;
+    QVector<Point3> points;
+    ids.reserve(removed.count());
+    indices.reserve(removed.count());
+    points.reserve(removed.count());
+
+    const QList<SceneNode *> items = Util::scene()->nodes->items();
+    for (int i = 0; i < items.count(); i++)
+    {
+        if (removed.contains(items.at(i)))
+        {
+            ids.append(items.at(i)->id());
+            indices.append(i);
+            points.append(items.at(i)->point());
+        }
+    }
+
+    return new SceneNodeCommandRemoveMulti(ids, indices, points, text);
 }
 
 // *************************************************************************************************************************************
@@ -84,8 +110,8 @@ CubePoint SceneNodeContainer::boundingBox() const
         max.x = qMax(max.x, node->point().x);
         min.y = qMin(min.y, node->point().y);
         max.y = qMax(max.y, node->point().y);
-        min.y = qMin(min.z, node->point().z);
-        max.y = qMax(max.z, node->point().z);
+        min.z = qMin(min.z, node->point().z);
+        max.z = qMax(max.z, node->point().z);
     }
 
     return CubePoint(min, max);
@@ -94,11 +120,8 @@ CubePoint SceneNodeContainer::boundingBox() const
 SceneNodeContainer SceneNodeContainer::selected()
 {
     SceneNodeContainer list;
-    foreach (SceneNode* item, this->data)
-    {
-        if (item->isSelected())
-            list.data.push_back(item);
-    }
+    for (int id = selection().next(0); id != -1; id = selection().next(id + 1))
+        list.data.push_back(find(id));
 
     return list;
 }
@@ -106,11 +129,8 @@ SceneNodeContainer SceneNodeContainer::selected()
 SceneNodeContainer SceneNodeContainer::highlighted()
 {
     SceneNodeContainer list;
-    foreach (SceneNode* item, this->data)
-    {
-        if (item->isHighlighted())
-            list.data.push_back(item);
-    }
+    for (int id = highlight().next(0); id != -1; id = highlight().next(id + 1))
+        list.data.push_back(find(id));
 
     return list;
 }
@@ -192,7 +212,7 @@ bool DSceneNode::save()
     {
         if (sceneNode->point() != point)
         {
-            Util::scene()->undoStack()->push(new SceneNodeCommandEdit(sceneNode->point(), point));
+            Util::scene()->undoStack()->push(new SceneNodeCommandEdit(sceneNode->id(), sceneNode->point(), point));
         }
     }
 
@@ -216,57 +236,70 @@ void DSceneNode::doEditingFinished()
 
 // undo framework *******************************************************************************************************************
 
-SceneNodeCommandAdd::SceneNodeCommandAdd(const Point3 &point, QUndoCommand *parent) : QUndoCommand(parent)
+SceneNodeCommandAdd::SceneNodeCommandAdd(const Point3 &point, int id, QUndoCommand *parent) : QUndoCommand(parent)
 {
     m_point = point;
+    m_id = id;
 }
 
 void SceneNodeCommandAdd::undo()
 {
-    SceneNode *node = Util::scene()->getNode(m_point);
+    SceneNode *node = Util::scene()->nodes->find(m_id);
     if (node)
     {
         Util::scene()->nodes->remove(node);
+        delete node;
         Util::scene()->invalidate();
     }
 }
 
 void SceneNodeCommandAdd::redo()
 {
-    Util::scene()->addNode(new SceneNode(m_point));
+    // node is already in the scene when the command is pushed
+    if (!Util::scene()->nodes->find(m_id))
+    {
+        SceneNode *node = new SceneNode(m_point);
+        node->setId(m_id);
+        Util::scene()->nodes->add(node);
+    }
     Util::scene()->invalidate();
 }
 
-SceneNodeCommandRemove::SceneNodeCommandRemove(const Point3 &point, QUndoCommand *parent) : QUndoCommand(parent)
+SceneNodeCommandRemove::SceneNodeCommandRemove(const Point3 &point, int id, QUndoCommand *parent) : QUndoCommand(parent)
 {
     m_point = point;
+    m_id = id;
 }
 
 void SceneNodeCommandRemove::undo()
 {
-    Util::scene()->addNode(new SceneNode(m_point));
+    SceneNode *node = new SceneNode(m_point);
+    node->setId(m_id);
+    Util::scene()->nodes->add(node);
     Util::scene()->invalidate();
 }
 
 void SceneNodeCommandRemove::redo()
 {
-    SceneNode *node = Util::scene()->getNode(m_point);
+    SceneNode *node = Util::scene()->nodes->find(m_id);
     if (node)
     {
         Util::scene()->nodes->remove(node);
+        delete node;
         Util::scene()->invalidate();
     }
 }
 
-SceneNodeCommandEdit::SceneNodeCommandEdit(const Point3 &point, const Point3 &pointNew, QUndoCommand *parent) : QUndoCommand(parent)
+SceneNodeCommandEdit::SceneNodeCommandEdit(int id, const Point3 &point, const Point3 &pointNew, QUndoCommand *parent) : QUndoCommand(parent)
 {
+    m_id = id;
     m_point = point;
     m_pointNew = pointNew;
 }
 
 void SceneNodeCommandEdit::undo()
 {
-    SceneNode *node = Util::scene()->getNode(m_pointNew);
+    SceneNode *node = Util::scene()->nodes->find(m_id);
     if (node)
     {
         node->setPoint(m_point);
@@ -276,7 +309,7 @@ void SceneNodeCommandEdit::undo()
 
 void SceneNodeCommandEdit::redo()
 {
-    SceneNode *node = Util::scene()->getNode(m_point);
+    SceneNode *node = Util::scene()->nodes->find(m_id);
     if (node)
     {
         node->setPoint(m_pointNew);
@@ -286,5 +319,212 @@ void SceneNodeCommandEdit::redo()
 
 bool SceneNode::isError()
 {
-    return false; // TODO
+    return Util::scene()->validation().isError(id());
+}
+
+// *************************************************************************************************************************************
+
+SceneNodeCommandMulti::SceneNodeCommandMulti(const QString &text, QUndoCommand *parent) : QUndoCommand(text, parent)
+{
+}
+
+int SceneNodeCommandMulti::memory() const
+{
+    if (isCompacted())
+        return m_compacted.size();
+
+    return (m_ids.count() + m_indices.count()) * sizeof(int) +
+            (m_points.count() + m_pointsNew.count()) * sizeof(Point3);
+}
+
+void SceneNodeCommandMulti::compact()
+{
+    if (isCompacted())
+        return;
+
+    QByteArray bytes;
+    QDataStream stream(&bytes, QIODevice::WriteOnly);
+    stream << m_ids.count() << m_indices.count() << m_points.count() << m_pointsNew.count();
+    stream.writeRawData((const char *) m_ids.constData(), m_ids.count() * sizeof(int));
+    stream.writeRawData((const char *) m_indices.constData(), m_indices.count() * sizeof(int));
+    stream.writeRawData((const char *) m_points.constData(), m_points.count() * sizeof(Point3));
+    stream.writeRawData((const char *) m_pointsNew.constData(), m_pointsNew.count() * sizeof(Point3));
+
+    m_compacted = qCompress(bytes);
+
+    m_ids.clear();
+    m_indices.clear();
+    m_points.clear();
+    m_pointsNew.clear();
+}
+
+void SceneNodeCommandMulti::expand()
+{
+    if (!isCompacted())
+        return;
+
+    QByteArray bytes = qUncompress(m_compacted);
+    QDataStream stream(bytes);
+
+    int ids, indices, points, pointsNew;
+    stream >> ids >> indices >> points >> pointsNew;
+
+    m_ids.resize(ids);
+    m_indices.resize(indices);
+    m_points.resize(points);
+    m_pointsNew.resize(pointsNew);
+    stream.readRawData((char *) m_ids.data(), ids * sizeof(int));
+    stream.readRawData((char *) m_indices.data(), indices * sizeof(int));
+    stream.readRawData((char *) m_points.data(), points * sizeof(Point3));
+    stream.readRawData((char *) m_pointsNew.data(), pointsNew * sizeof(Point3));
+
+    m_compacted.clear();
+}
+
+/// positions (ascending) of the nodes with given ids in the scene container, one pass
+static QVector<int> sceneNodeIndices(const QVector<int> &ids)
+{
+    QSet<int> set = QSet<int>::fromList(ids.toList());
+
+    QVector<int> indices;
+    indices.reserve(ids.count());
+
+    const QList<SceneNode *> items = Util::scene()->nodes->items();
+    for (int i = 0; i < items.count(); i++)
+        if (set.contains(items.at(i)->id()))
+            indices.append(i);
+
+    return indices;
+}
+
+SceneNodeCommandAddMulti::SceneNodeCommandAddMulti(const QVector<Point3> &points, const QString &text, QUndoCommand *parent)
+    : SceneNodeCommandMulti(text, parent)
+{
+    m_points = points;
+}
+
+void SceneNodeCommandAddMulti::undo()
+{
+    expand();
+
+    qDeleteAll(Util::scene()->nodes->removeAt(sceneNodeIndices(m_ids)));
+
+    Util::scene()->invalidate();
+}
+
+void SceneNodeCommandAddMulti::redo()
+{
+    expand();
+
+    // ids are assigned at the first redo and kept since
+    bool isNew = m_ids.isEmpty();
+    if (isNew)
+        m_ids.resize(m_points.count());
+
+    for (int i = 0; i < m_points.count(); i++)
+    {
+        SceneNode *node = new SceneNode(m_points[i]);
+        if (!isNew)
+            node->setId(m_ids[i]);
+
+        Util::scene()->nodes->add(node);
+        m_ids[i] = node->id();
+    }
+
+    Util::scene()->invalidate();
+}
+
+SceneNodeCommandRemoveMulti::SceneNodeCommandRemoveMulti(const QVector<int> &ids, const QVector<int> &indices, const QVector<Point3> &points,
+                                                         const QString &text, QUndoCommand *parent)
+    : SceneNodeCommandMulti(text, parent)
+{
+    m_ids = ids;
+    m_indices = indices;
+    m_points = points;
+}
+
+void SceneNodeCommandRemoveMulti::undo()
+{
+    expand();
+
+    QList<SceneNode *> nodes;
+    nodes.reserve(m_points.count());
+    for (int i = 0; i < m_points.count(); i++)
+    {
+        SceneNode *node = new SceneNode(m_points[i]);
+        node->setId(m_ids[i]);
+        nodes.append(node);
+    }
+
+    Util::scene()->nodes->insertAt(m_indices, nodes);
+
+    Util::scene()->invalidate();
+}
+
+void SceneNodeCommandRemoveMulti::redo()
+{
+    expand();
+
+    // positions are valid in a linear history, they are found again by ids in one pass otherwise
+    const QList<SceneNode *> items = Util::scene()->nodes->items();
+
+    bool isValid = true;
+    for (int i = 0; i < m_indices.count(); i++)
+    {
+        if (m_indices[i] >= items.count() || items.at(m_indices[i])->id() != m_ids[i])
+        {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (!isValid)
+    {
+        m_indices = sceneNodeIndices(m_ids);
+
+        m_ids.resize(m_indices.count());
+        m_points.resize(m_indices.count());
+        for (int i = 0; i < m_indices.count(); i++)
+        {
+            m_ids[i] = items.at(m_indices[i])->id();
+            m_points[i] = items.at(m_indices[i])->point();
+        }
+    }
+
+    qDeleteAll(Util::scene()->nodes->removeAt(m_indices));
+
+    Util::scene()->invalidate();
+}
+
+SceneNodeCommandEditMulti::SceneNodeCommandEditMulti(const QVector<int> &ids, const QVector<Point3> &points, const QVector<Point3> &pointsNew,
+                                                     const QString &text, QUndoCommand *parent)
+    : SceneNodeCommandMulti(text, parent)
+{
+    m_ids = ids;
+    m_points = points;
+    m_pointsNew = pointsNew;
+}
+
+void SceneNodeCommandEditMulti::undo()
+{
+    expand();
+    apply(m_points);
+}
+
+void SceneNodeCommandEditMulti::redo()
+{
+    expand();
+    apply(m_pointsNew);
+}
+
+void SceneNodeCommandEditMulti::apply(const QVector<Point3> &points)
+{
+    for (int i = 0; i < m_ids.count(); i++)
+    {
+        SceneNode *node = Util::scene()->nodes->find(m_ids[i]);
+        if (node)
+            node->setPoint(points[i]);
+    }
+
+    Util::scene()->invalidate();
 }
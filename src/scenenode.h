@@ -24,6 +24,7 @@
 #include "scenebasic.h"
 
 class SceneNodeCommandRemove;
+class SceneNodeCommandRemoveMulti;
 class QDomElement;
 
 class SceneNode : public SceneBasic
@@ -32,7 +33,7 @@ public:
     SceneNode(const Point3 &m_point);
 
     inline Point3 point() const { return m_point; }
-    inline void setPoint(const Point3 &point) { m_point = point; }
+    inline void setPoint(const Point3 &point) { m_point = point; moved(); }
 
     // geometry editor
     bool isError();
@@ -41,6 +42,7 @@ public:
     int showDialog(QWidget *parent, bool isNew = false);
 
     SceneNodeCommandRemove* getRemoveCommand();
+    static SceneNodeCommandRemoveMulti* getRemoveCommand(const QList<SceneNode *> &nodes, const QString &text);
 
 private:
     Point3 m_point;
@@ -63,6 +65,7 @@ public:
     CubePoint boundingBox() const;
 
     //TODO should be in SceneBasicContainer, but I would have to cast the result....
+    /// selected (highlighted) nodes in the order of their ids, O(selected)
     SceneNodeContainer selected();
     SceneNodeContainer highlighted();
 
@@ -99,38 +102,101 @@ private slots:
 
 // undo framework *******************************************************************************************************************
 
+// commands refer to nodes by their ids, nodes removed by a command are restored with the same id
+
 class SceneNodeCommandAdd : public QUndoCommand
 {
 public:
-    SceneNodeCommandAdd(const Point3 &point, QUndoCommand *parent = 0);
+    SceneNodeCommandAdd(const Point3 &point, int id, QUndoCommand *parent = 0);
     void undo();
     void redo();
 
 private:
     Point3 m_point;
+    int m_id;
 };
 
 class SceneNodeCommandRemove : public QUndoCommand
 {
 public:
-    SceneNodeCommandRemove(const Point3 &point, QUndoCommand *parent = 0);
+    SceneNodeCommandRemove(const Point3 &point, int id, QUndoCommand *parent = 0);
     void undo();
     void redo();
 
 private:
     Point3 m_point;
+    int m_id;
 };
 
 class SceneNodeCommandEdit : public QUndoCommand
 {
 public:
-    SceneNodeCommandEdit(const Point3 &point, const Point3 &pointNew,  QUndoCommand *parent = 0);
+    SceneNodeCommandEdit(int id, const Point3 &point, const Point3 &pointNew, QUndoCommand *parent = 0);
     void undo();
     void redo();
 
 private:
+    int m_id;
     Point3 m_point;
     Point3 m_pointNew;
 };
 
+/// bulk command, ids, positions in the scene container and coordinates of the nodes are kept in compact arrays,
+/// the change is applied in one pass over the container and the scene is invalidated once
+class SceneNodeCommandMulti : public QUndoCommand
+{
+public:
+    SceneNodeCommandMulti(const QString &text, QUndoCommand *parent = 0);
+
+    /// memory used by the arrays (bytes)
+    int memory() const;
+
+    /// compresses the arrays of an old command, they are restored at its next undo or redo
+    void compact();
+    inline bool isCompacted() const { return !m_compacted.isEmpty(); }
+
+protected:
+    QVector<int> m_ids;
+    QVector<int> m_indices;
+    QVector<Point3> m_points;
+    QVector<Point3> m_pointsNew;
+
+    void expand();
+
+private:
+    QByteArray m_compacted;
+};
+
+class SceneNodeCommandAddMulti : public SceneNodeCommandMulti
+{
+public:
+    /// nodes are appended to the scene in redo()
+    SceneNodeCommandAddMulti(const QVector<Point3> &points, const QString &text, QUndoCommand *parent = 0);
+    void undo();
+    void redo();
+};
+
+class SceneNodeCommandRemoveMulti : public SceneNodeCommandMulti
+{
+public:
+    /// ids of the nodes, their positions in the scene container (ascending) and coordinates
+    SceneNodeCommandRemoveMulti(const QVector<int> &ids, const QVector<int> &indices, const QVector<Point3> &points,
+                                const QString &text, QUndoCommand *parent = 0);
+    void undo();
+    void redo();
+};
+
+class SceneNodeCommandEditMulti : public SceneNodeCommandMulti
+{
+public:
+    /// ids of the nodes, their coordinates before and after the edit
+    SceneNodeCommandEditMulti(const QVector<int> &ids, const QVector<Point3> &points, const QVector<Point3> &pointsNew,
+                              const QString &text, QUndoCommand *parent = 0);
+    void undo();
+    void redo();
+
+private:
+    void apply(const QVector<Point3> &points);
+};
+
 #endif // SCENENODE_H
@@ -0,0 +1,193 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "scenesnapshot.h"
+
+#include "scenebasic.h"
+#include "scenenode.h"
+
+bool SceneSnapshotChunk::operator==(const SceneSnapshotChunk &chunk) const
+{
+    if (ids != chunk.ids)
+        return false;
+
+    for (int i = 0; i < points.count(); i++)
+        if (points[i] != chunk.points[i])
+            return false;
+
+    return true;
+}
+
+// *************************************************************************************************************************************
+
+SceneSnapshot::SceneSnapshot() : m_count(0)
+{
+}
+
+SceneSnapshot::SceneSnapshot(const SceneSnapshot &previous, const SceneNodeContainer *nodes, const SceneBitSet &changed)
+    : m_chunks(previous.m_chunks), m_count(previous.m_count)
+{
+    const SceneBitSet &ids = nodes->ids();
+
+    int chunk = -1;
+    for (int id = changed.next(0); id != -1; id = changed.next((chunk + 1) * SCENESNAPSHOTCHUNK))
+    {
+        chunk = id / SCENESNAPSHOTCHUNK;
+        if (chunk >= m_chunks.count())
+            m_chunks.resize(chunk + 1);
+
+        // nodes of the chunk in the container
+        SceneSnapshotChunk *rebuilt = new SceneSnapshotChunk();
+        int end = (chunk + 1) * SCENESNAPSHOTCHUNK;
+        for (int node = ids.next(chunk * SCENESNAPSHOTCHUNK); node != -1 && node < end; node = ids.next(node + 1))
+        {
+            rebuilt->ids.append(node);
+            rebuilt->points.append(nodes->find(node)->point());
+        }
+
+        if (m_chunks[chunk])
+            m_count -= m_chunks[chunk]->ids.count();
+        m_count += rebuilt->ids.count();
+
+        if (rebuilt->ids.isEmpty())
+        {
+            delete rebuilt;
+            m_chunks[chunk].clear();
+        }
+        else
+        {
+            m_chunks[chunk] = QSharedPointer<const SceneSnapshotChunk>(rebuilt);
+        }
+    }
+
+    // trailing empty chunks
+    while (!m_chunks.isEmpty() && !m_chunks.last())
+        m_chunks.remove(m_chunks.count() - 1);
+}
+
+QVector<int> SceneSnapshot::ids() const
+{
+    QVector<int> ids;
+    ids.reserve(m_count);
+
+    foreach (QSharedPointer<const SceneSnapshotChunk> chunk, m_chunks)
+        if (chunk)
+            ids += chunk->ids;
+
+    return ids;
+}
+
+QList<Point3> SceneSnapshot::points() const
+{
+    QList<Point3> points;
+    points.reserve(m_count);
+
+    foreach (QSharedPointer<const SceneSnapshotChunk> chunk, m_chunks)
+        if (chunk)
+            foreach (Point3 point, chunk->points)
+                points.append(point);
+
+    return points;
+}
+
+CubePoint SceneSnapshot::boundingBox() const
+{
+    if (isEmpty())
+        return CubePoint(Point3(-0.5, -0.5, -0.5), Point3(0.5, 0.5, 0.5));
+
+    Point3 min( numeric_limits<double>::max(),  numeric_limits<double>::max(),  numeric_limits<double>::max());
+    Point3 max(-numeric_limits<double>::max(), -numeric_limits<double>::max(), -numeric_limits<double>::max());
+
+    foreach (QSharedPointer<const SceneSnapshotChunk> chunk, m_chunks)
+    {
+        if (!chunk)
+            continue;
+
+        foreach (Point3 point, chunk->points)
+        {
+            min.x = qMin(min.x, point.x);
+            max.x = qMax(max.x, point.x);
+            min.y = qMin(min.y, point.y);
+            max.y = qMax(max.y, point.y);
+            min.z = qMin(min.z, point.z);
+            max.z = qMax(max.z, point.z);
+        }
+    }
+
+    return CubePoint(min, max);
+}
+
+void SceneSnapshot::difference(const SceneSnapshot &previous, QList<Point3> &removed, QList<Point3> &added) const
+{
+    static const SceneSnapshotChunk empty;
+
+    for (int i = 0; i < qMax(m_chunks.count(), previous.m_chunks.count()); i++)
+    {
+        QSharedPointer<const SceneSnapshotChunk> chunkNew = (i < m_chunks.count()) ? m_chunks[i] : QSharedPointer<const SceneSnapshotChunk>();
+        QSharedPointer<const SceneSnapshotChunk> chunkOld = (i < previous.m_chunks.count()) ? previous.m_chunks[i] : QSharedPointer<const SceneSnapshotChunk>();
+        if (chunkNew == chunkOld)
+            continue;
+
+        const SceneSnapshotChunk &to = chunkNew ? *chunkNew : empty;
+        const SceneSnapshotChunk &from = chunkOld ? *chunkOld : empty;
+
+        // ids are ascending in both chunks
+        int a = 0;
+        int b = 0;
+        while (a < from.ids.count() || b < to.ids.count())
+        {
+            if (b == to.ids.count() || (a < from.ids.count() && from.ids[a] < to.ids[b]))
+            {
+                removed.append(from.points[a++]);
+            }
+            else if (a == from.ids.count() || to.ids[b] < from.ids[a])
+            {
+                added.append(to.points[b++]);
+            }
+            else
+            {
+                if (from.points[a] != to.points[b])
+                {
+                    removed.append(from.points[a]);
+                    added.append(to.points[b]);
+                }
+                a++;
+                b++;
+            }
+        }
+    }
+}
+
+bool SceneSnapshot::operator==(const SceneSnapshot &snapshot) const
+{
+    if (m_count != snapshot.m_count || m_chunks.count() != snapshot.m_chunks.count())
+        return false;
+
+    for (int i = 0; i < m_chunks.count(); i++)
+    {
+        // shared chunk
+        if (m_chunks[i] == snapshot.m_chunks[i])
+            continue;
+
+        if (!m_chunks[i] || !snapshot.m_chunks[i] || !(*m_chunks[i] == *snapshot.m_chunks[i]))
+            return false;
+    }
+
+    return true;
+}
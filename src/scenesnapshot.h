@@ -0,0 +1,69 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef SCENESNAPSHOT_H
+#define SCENESNAPSHOT_H
+
+#include "util.h"
+
+class SceneNodeContainer;
+class SceneBitSet;
+
+/// nodes with ids in one range of SCENESNAPSHOTCHUNK ids (ascending), never changed once built
+struct SceneSnapshotChunk
+{
+    QVector<int> ids;
+    QVector<Point3> points;
+
+    bool operator==(const SceneSnapshotChunk &chunk) const;
+};
+
+/// immutable geometry of the scene, cheap to copy and to keep while the scene is edited
+/// chunks not touched by the edits are shared with the previous snapshot
+class SceneSnapshot
+{
+public:
+    SceneSnapshot();
+    /// previous snapshot with rebuilt chunks of the changed ids
+    SceneSnapshot(const SceneSnapshot &previous, const SceneNodeContainer *nodes, const SceneBitSet &changed);
+
+    inline int count() const { return m_count; }
+    inline bool isEmpty() const { return m_count == 0; }
+
+    /// ids of the nodes (ascending) and their coordinates in the same order
+    QVector<int> ids() const;
+    QList<Point3> points() const;
+
+    /// bounding box of the nodes (same as Scene::boundingBox() for the geometry)
+    CubePoint boundingBox() const;
+
+    /// nodes removed from (or moved from) and added to (or moved to) the previous snapshot,
+    /// only chunks which are not shared are compared
+    void difference(const SceneSnapshot &previous, QList<Point3> &removed, QList<Point3> &added) const;
+
+    /// same geometry (shared chunks are not compared)
+    bool operator==(const SceneSnapshot &snapshot) const;
+    inline bool operator!=(const SceneSnapshot &snapshot) const { return !(*this == snapshot); }
+
+private:
+    QVector<QSharedPointer<const SceneSnapshotChunk> > m_chunks;
+    int m_count;
+};
+
+#endif // SCENESNAPSHOT_H
@@ -175,6 +175,6 @@ void SceneTransformDialog::doTransform()
         if (!txtScaleBasePointY->evaluate(false)) return;
         if (!txtScaleFactor->evaluate(false)) return;
         // TODO
-        Util::scene()->transformScale(Point3(txtScaleBasePointX->number(), txtScaleBasePointY->number(), 1.0), txtScaleFactor->number(), chkCopy->isChecked());
+        Util::scene()->transformScale(Point3(txtScaleBasePointX->number(), txtScaleBasePointY->number(), 0.0), txtScaleFactor->number(), chkCopy->isChecked());
     }
 }
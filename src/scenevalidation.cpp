@@ -0,0 +1,135 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "scenevalidation.h"
+
+#include "util/spatialhash.h"
+
+SceneValidation::SceneValidation() : m_tolerance(SCENEVALIDATIONTOLERANCE)
+{
+}
+
+SceneValidation::SceneValidation(const SceneSnapshot &snapshot, double tolerance)
+    : m_snapshot(snapshot), m_tolerance(tolerance)
+{
+    QVector<int> ids = snapshot.ids();
+    QVector<Point3> points = snapshot.points().toVector();
+    int count = ids.count();
+
+    const Point3 *p = points.constData();
+
+    // singular coordinates (comparisons with NaN fail)
+    QVector<char> invalid(count);
+    char *pi = invalid.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+        pi[i] = !((fabs(p[i].x) <= SCENEVALIDATIONRANGE) &&
+                  (fabs(p[i].y) <= SCENEVALIDATIONRANGE) &&
+                  (fabs(p[i].z) <= SCENEVALIDATIONRANGE));
+
+    // valid nodes in the spatial hash, values are positions in the arrays
+    Point3 min( numeric_limits<double>::max(),  numeric_limits<double>::max(),  numeric_limits<double>::max());
+    Point3 max(-numeric_limits<double>::max(), -numeric_limits<double>::max(), -numeric_limits<double>::max());
+    int valid = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (pi[i])
+        {
+            m_invalid.insert(ids[i]);
+            continue;
+        }
+
+        min.x = qMin(min.x, p[i].x);
+        max.x = qMax(max.x, p[i].x);
+        min.y = qMin(min.y, p[i].y);
+        max.y = qMax(max.y, p[i].y);
+        min.z = qMin(min.z, p[i].z);
+        max.z = qMax(max.z, p[i].z);
+        valid++;
+    }
+
+    if (valid < 2)
+        return;
+
+    SpatialHash hash(qMax(SpatialHash::cellSize(CubePoint(min, max), valid), 2.0 * m_tolerance), m_tolerance);
+    for (int i = 0; i < count; i++)
+        if (!pi[i])
+            hash.insert(p[i], i);
+
+    // coincident nodes before each node, queries are independent
+    QVector<QList<int> > neighbours(count);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (int i = 0; i < count; i++)
+    {
+        if (pi[i])
+            continue;
+
+        QList<int> found = hash.findAll(p[i]);
+        if (found.count() < 2)
+            continue;
+
+        QList<int> before;
+        foreach (int j, found)
+            if (j < i)
+                before.append(j);
+        neighbours[i] = before;
+    }
+
+    // union-find over all coincident pairs, the root of a group is its first node
+    QVector<int> parents(count);
+    for (int i = 0; i < count; i++)
+        parents[i] = i;
+
+    for (int i = 0; i < count; i++)
+    {
+        foreach (int j, neighbours[i])
+        {
+            int a = root(parents, i);
+            int b = root(parents, j);
+            if (a < b)
+                parents[b] = a;
+            else if (b < a)
+                parents[a] = b;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int target = root(parents, i);
+        if (target == i)
+            continue;
+
+        m_duplicates.insert(ids[i]);
+        m_merged.insert(ids[i], ids[target]);
+    }
+}
+
+int SceneValidation::root(QVector<int> &parents, int i)
+{
+    while (parents[i] != i)
+    {
+        // path halving
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+
+    return i;
+}
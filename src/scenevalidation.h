@@ -0,0 +1,63 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef SCENEVALIDATION_H
+#define SCENEVALIDATION_H
+
+#include "util.h"
+#include "scenebasic.h"
+#include "scenesnapshot.h"
+
+/// validation of the geometry of a snapshot, computed in parallel over all nodes
+/// nodes closer than the tolerance (in all coordinates) are duplicates, each group is merged into its node
+/// with the lowest id (groups are transitive, a chain of close nodes is one group)
+/// nodes with coordinates which are not finite or out of SCENEVALIDATIONRANGE make the kernels singular (overflow)
+class SceneValidation
+{
+public:
+    SceneValidation();
+    SceneValidation(const SceneSnapshot &snapshot, double tolerance);
+
+    inline const SceneSnapshot &snapshot() const { return m_snapshot; }
+    inline double tolerance() const { return m_tolerance; }
+
+    /// nodes merged into another node
+    inline const SceneBitSet &duplicates() const { return m_duplicates; }
+    /// nodes with singular coordinates
+    inline const SceneBitSet &invalid() const { return m_invalid; }
+
+    /// node the duplicate is merged into or -1
+    inline int mergedInto(int id) const { return m_merged.value(id, -1); }
+
+    inline bool isError(int id) const { return m_duplicates.contains(id) || m_invalid.contains(id); }
+    inline bool isValid() const { return m_duplicates.isEmpty() && m_invalid.isEmpty(); }
+
+private:
+    SceneSnapshot m_snapshot;
+    double m_tolerance;
+
+    SceneBitSet m_duplicates;
+    SceneBitSet m_invalid;
+    QHash<int, int> m_merged;
+
+    /// root of the group of the node in the union-find forest
+    static int root(QVector<int> &parents, int i);
+};
+
+#endif // SCENEVALIDATION_H
@@ -101,7 +101,8 @@ void SceneViewWidget::iconLeft(const QIcon &left)
 
 // **********************************************************************************************
 
-SceneViewCommon::SceneViewCommon(QWidget *parent) : QGLWidget(QGLFormat(QGL::SampleBuffers), parent)
+SceneViewCommon::SceneViewCommon(QWidget *parent) : QGLWidget(QGLFormat(QGL::SampleBuffers), parent),
+    m_offscreenBuffer(NULL), m_isRenderingOffscreen(false)
 {
     m_mainWindow = (QMainWindow *) parent;
 
@@ -116,6 +117,7 @@ SceneViewCommon::SceneViewCommon(QWidget *parent) : QGLWidget(QGLFormat(QGL::Sam
 
 SceneViewCommon::~SceneViewCommon()
 {
+    releaseOffscreenBuffer();
 }
 
 void SceneViewCommon::createActions()
@@ -140,10 +142,11 @@ void SceneViewCommon::setupViewport(int w, int h)
 
 ErrorResult SceneViewCommon::saveImageToFile(const QString &fileName, int w, int h)
 {
-    QPixmap pixmap = renderScenePixmap(w, h);
-    if (pixmap.save(fileName, "PNG"))
-        resizeGL(width(), height());
-    else
+    QImage image = renderSceneImage(w, h);
+    if (image.isNull())
+        return ErrorResult(ErrorResultType_Critical, tr("Scene cannot be rendered."));
+
+    if (!image.save(fileName, "PNG"))
         return ErrorResult(ErrorResultType_Critical, tr("Image cannot be saved to the file '%1'.").arg(fileName));
 
     return ErrorResult();
@@ -151,6 +154,9 @@ ErrorResult SceneViewCommon::saveImageToFile(const QString &fileName, int w, int
 
 QPixmap SceneViewCommon::renderScenePixmap(int w, int h, bool useContext)
 {
+    if (QGLFramebufferObject::hasOpenGLFramebufferObjects())
+        return QPixmap::fromImage(renderSceneImage(w, h));
+
     QPixmap pixmap = renderPixmap((w == 0) ? width() : w,
                                   (h == 0) ? height() : h,
                                   useContext);
@@ -159,6 +165,64 @@ QPixmap SceneViewCommon::renderScenePixmap(int w, int h, bool useContext)
     return pixmap;
 }
 
+QImage SceneViewCommon::renderSceneImage(int w, int h)
+{
+    if (w == 0) w = width();
+    if (h == 0) h = height();
+
+    // without framebuffer objects use the pixel buffer of renderPixmap()
+    if (!QGLFramebufferObject::hasOpenGLFramebufferObjects())
+    {
+        QImage image = renderPixmap(w, h).toImage();
+        resizeGL(width(), height());
+
+        return image;
+    }
+
+    makeCurrent();
+
+    if (m_offscreenBuffer && m_offscreenBuffer->size() != QSize(w, h))
+        releaseOffscreenBuffer();
+
+    if (!m_offscreenBuffer)
+    {
+        m_offscreenBuffer = new QGLFramebufferObject(w, h, QGLFramebufferObject::Depth);
+        if (!m_offscreenBuffer->isValid())
+        {
+            releaseOffscreenBuffer();
+            return QImage();
+        }
+    }
+
+    m_offscreenBuffer->bind();
+    m_isRenderingOffscreen = true;
+
+    resizeGL(w, h);
+    paintGL();
+    glFlush();
+
+    m_isRenderingOffscreen = false;
+    m_offscreenBuffer->release();
+
+    QImage image = m_offscreenBuffer->toImage();
+
+    // restore the widget viewport
+    resizeGL(width(), height());
+
+    return image;
+}
+
+void SceneViewCommon::releaseOffscreenBuffer()
+{
+    if (m_offscreenBuffer)
+    {
+        makeCurrent();
+
+        delete m_offscreenBuffer;
+        m_offscreenBuffer = NULL;
+    }
+}
+
 void SceneViewCommon::loadProjectionViewPort()
 {
     glMatrixMode(GL_PROJECTION);
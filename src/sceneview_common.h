@@ -21,6 +21,7 @@
 #define SCENEVIEWCOMMON_H
 
 #include <QGLWidget>
+#include <QGLFramebufferObject>
 
 #include "util.h"
 #include "chartdialog.h"
@@ -88,6 +89,11 @@ public:
     ErrorResult saveImageToFile(const QString &fileName, int w = 0, int h = 0);
     QPixmap renderScenePixmap(int w = 0, int h = 0, bool useContext = false);
 
+    /// renders the scene into the offscreen framebuffer, works for hidden widget (headless mode and scripts)
+    /// the framebuffer is kept for the next call, so a batch of frames with the same size reuses it
+    QImage renderSceneImage(int w = 0, int h = 0);
+    void releaseOffscreenBuffer();
+
     void loadBackgroundImage(const QString &fileName, double x = 0, double y = 0, double w = 1.0, double h = 1.0);
 
     virtual QIcon iconView() { return QIcon(); }
@@ -114,6 +120,12 @@ protected:
     bool m_zoomRegion;
     QPointF m_zoomRegionPos;
 
+    // offscreen rendering
+    QGLFramebufferObject *m_offscreenBuffer;
+    bool m_isRenderingOffscreen;
+
+    inline bool isRenderable() const { return isVisible() || m_isRenderingOffscreen; }
+
     void createActions();
     void createMenu();
 
@@ -129,7 +141,11 @@ protected:
 
     void closeEvent(QCloseEvent *event);
 
-    inline double aspect() const { return (double) width() / (double) height(); }
+    // size of the current render target
+    inline int contextWidth() const { return m_isRenderingOffscreen ? m_offscreenBuffer->width() : width(); }
+    inline int contextHeight() const { return m_isRenderingOffscreen ? m_offscreenBuffer->height() : height(); }
+
+    inline double aspect() const { return (double) contextWidth() / (double) contextHeight(); }
 };
 
 #endif // SCENEVIEWCOMMON_H
@@ -109,8 +109,8 @@ void SceneViewCommon3D::paintAxes()
 {
     loadProjectionViewPort();
 
-    glScaled(2.0 / width(), 2.0 / height(), 2.0 / height());
-    glTranslated(- width() / 2.0 + 30, -height() / 2.0 + 30, 0.0);
+    glScaled(2.0 / contextWidth(), 2.0 / contextHeight(), 2.0 / contextHeight());
+    glTranslated(- contextWidth() / 2.0 + 30, - contextHeight() / 2.0 + 30, 0.0);
 
     glRotated(m_rotation3d.x, 1.0, 0.0, 0.0);
     glRotated(m_rotation3d.z, 0.0, 1.0, 0.0);
@@ -25,8 +25,21 @@
 #include "scenebasic.h"
 #include "scenenode.h"
 
+#include "util/vectorexport.h"
+
 #include "gl2ps/gl2ps.h"
 
+// sorts indices by depth of nodes
+class DepthLessThan
+{
+public:
+    DepthLessThan(const double *depth) : m_depth(depth) {}
+    inline bool operator()(int a, int b) const { return m_depth[a] < m_depth[b]; }
+
+private:
+    const double *m_depth;
+};
+
 SceneViewPreprocessor::SceneViewPreprocessor(QWidget *parent)
     : SceneViewCommon3D(NULL, parent)
 {
@@ -86,11 +99,8 @@ void SceneViewPreprocessor::doSceneObjectProperties()
     {
         if (Util::scene()->selectedCount() == 1)
         {
-            for (int i = 0; i < Util::scene()->nodes->length(); i++)
-            {
-                if (Util::scene()->nodes->at(i)->isSelected())
-                    Util::scene()->nodes->at(i)->showDialog(this);
-            }
+            int id = Util::scene()->nodes->selection().next(0);
+            Util::scene()->nodes->find(id)->showDialog(this);
         }
     }
 
@@ -134,8 +144,10 @@ void SceneViewPreprocessor::doSceneGeometryModeSet(QAction *action)
         break;
     }
 
+    Util::scene()->beginTransaction();
     Util::scene()->highlightNone();
     Util::scene()->selectNone();
+    Util::scene()->commitTransaction();
     m_nodeLast = NULL;
 
     refresh();
@@ -246,7 +258,7 @@ void SceneViewPreprocessor::loadBackgroundImage(const QString &fileName, double
 
 void SceneViewPreprocessor::paintGL()
 {
-    if (!isVisible()) return;
+    if (!isRenderable()) return;
     makeCurrent();
 
     glClearColor(Util::config()->colorBackground.redF(),
@@ -318,39 +330,197 @@ ErrorResult SceneViewPreprocessor::saveGeometryToFile(const QString &fileName, i
 {
     // store old value
     SceneGeometryMode sceneMode = m_sceneMode;
-    m_sceneMode == SceneGeometryMode_OperateOnNodes;
+    m_sceneMode = SceneGeometryMode_OperateOnNodes;
     actOperateOnNodes->trigger();
 
+    ErrorResult result;
+    switch (format)
+    {
+    case GL2PS_SVG:
+        result = exportGeometry(fileName, VectorExportFormat_SVG);
+        break;
+    case GL2PS_EPS:
+        result = exportGeometry(fileName, VectorExportFormat_EPS);
+        break;
+    case GL2PS_PDF:
+        result = exportGeometry(fileName, VectorExportFormat_PDF);
+        break;
+    default:
+        result = exportGeometryGL2PS(fileName, format);
+    }
+
+    // restore viewport
+    m_sceneMode = sceneMode;
+    if (m_sceneMode == SceneGeometryMode_OperateOnNodes) actOperateOnNodes->trigger();
+
+    return result;
+}
+
+ErrorResult SceneViewPreprocessor::exportGeometry(const QString &fileName, VectorExportFormat format)
+{
+    int w = contextWidth();
+    int h = contextHeight();
+
+    // transformation of the view
+    makeCurrent();
+    loadProjection3d(true);
+
+    double modelview[16];
+    double projection[16];
+    glGetDoublev(GL_MODELVIEW_MATRIX, modelview);
+    glGetDoublev(GL_PROJECTION_MATRIX, projection);
+
+    double matrix[16];
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+        {
+            matrix[j*4 + i] = 0.0;
+            for (int k = 0; k < 4; k++)
+                matrix[j*4 + i] += projection[k*4 + i] * modelview[j*4 + k];
+        }
+
+    // window coordinates and depth of nodes
+    QList<SceneNode *> nodes = Util::scene()->nodes->items();
+    int count = nodes.count();
+
+    QVector<double> windowX(count);
+    QVector<double> windowY(count);
+    QVector<double> depth(count);
+
+    double *windowXData = windowX.data();
+    double *windowYData = windowY.data();
+    double *depthData = depth.data();
+    const QList<SceneNode *> &nodesData = nodes;
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+    {
+        Point3 point = nodesData.at(i)->point();
+
+        double clip[4];
+        for (int r = 0; r < 4; r++)
+            clip[r] = matrix[r] * point.x + matrix[4 + r] * point.y + matrix[8 + r] * point.z + matrix[12 + r];
+
+        windowXData[i] = (clip[0] / clip[3] + 1.0) / 2.0 * w;
+        windowYData[i] = (clip[1] / clip[3] + 1.0) / 2.0 * h;
+        depthData[i] = clip[2] / clip[3];
+    }
+
+    double radius = Util::config()->nodeSize / 2.0;
+
+    // front to back
+    QVector<int> order;
+    order.reserve(count);
+    for (int i = 0; i < count; i++)
+        if (windowX[i] + radius >= 0 && windowX[i] - radius <= w && windowY[i] + radius >= 0 && windowY[i] - radius <= h)
+            order.append(i);
+
+    qSort(order.begin(), order.end(), DepthLessThan(depth.constData()));
+
+    // occlusion culling on pixel grid, a node is skipped when all pixels it touches
+    // are already fully covered by the nodes in front of it
+    QBitArray covered(w * h);
+    double inner = radius / sqrt(2.0);
+
+    QVector<int> visible;
+    visible.reserve(order.count());
+    foreach (int i, order)
+    {
+        int x0 = qMax(0, (int) floor(windowX[i] - radius));
+        int x1 = qMin(w - 1, (int) floor(windowX[i] + radius));
+        int y0 = qMax(0, (int) floor(windowY[i] - radius));
+        int y1 = qMin(h - 1, (int) floor(windowY[i] + radius));
+
+        bool hidden = true;
+        for (int y = y0; y <= y1 && hidden; y++)
+            for (int x = x0; x <= x1 && hidden; x++)
+                if (!covered.testBit(y * w + x))
+                    hidden = false;
+
+        if (hidden)
+            continue;
+
+        visible.append(i);
+
+        // pixels completely inside the disc
+        int cx0 = qMax(0, (int) ceil(windowX[i] - inner));
+        int cx1 = qMin(w, (int) floor(windowX[i] + inner));
+        int cy0 = qMax(0, (int) ceil(windowY[i] - inner));
+        int cy1 = qMin(h, (int) floor(windowY[i] + inner));
+        for (int y = cy0; y < cy1; y++)
+            for (int x = cx0; x < cx1; x++)
+                covered.setBit(y * w + x);
+    }
+
+    VectorExport exporter(format, w, h);
+    if (!exporter.begin(fileName))
+        return ErrorResult(ErrorResultType_Critical, tr("File '%1' cannot be opened.").arg(fileName));
+
+    // background
+    exporter.setColor(Util::config()->colorBackground);
+    exporter.drawRectangle(0, 0, w, h);
+
+    // back to front
+    for (int v = visible.count() - 1; v >= 0; v--)
+    {
+        int i = visible[v];
+        SceneNode *node = nodes[i];
+
+        exporter.setColor(Util::config()->colorNodes);
+        exporter.drawDisc(windowX[i], windowY[i], radius);
+
+        exporter.setColor(Util::config()->colorBackground);
+        exporter.drawDisc(windowX[i], windowY[i], radius - 1.0);
+
+        if ((node->isSelected()) || (node->isHighlighted()) || (node->isError()))
+        {
+            if (node->isError())
+                exporter.setColor(Util::config()->colorCrossed);
+            if (node->isHighlighted())
+                exporter.setColor(Util::config()->colorHighlighted);
+            if (node->isSelected())
+                exporter.setColor(Util::config()->colorSelected);
+
+            exporter.drawDisc(windowX[i], windowY[i], radius - 1.0);
+        }
+    }
+
+    if (!exporter.end())
+        return ErrorResult(ErrorResultType_Critical, tr("File '%1' cannot be written.").arg(fileName));
+
+    return ErrorResult();
+}
+
+ErrorResult SceneViewPreprocessor::exportGeometryGL2PS(const QString &fileName, int format)
+{
     makeCurrent();
     int state = GL2PS_OVERFLOW;
-    int buffsize = 0;
     GLint options = GL2PS_DRAW_BACKGROUND | GL2PS_USE_CURRENT_VIEWPORT;
 
+    // estimate of the feedback buffer (points with three colors), doubled on overflow
+    int buffsize = qMax(1024*1024, 3 * 16 * (int) sizeof(GLfloat) * Util::scene()->nodes->length());
+
     FILE *fp = fopen(fileName.toStdString().c_str(), "wb");
+    if (!fp)
+        return ErrorResult(ErrorResultType_Critical, tr("File '%1' cannot be opened.").arg(fileName));
+
     while (state == GL2PS_OVERFLOW)
     {
-        buffsize += 1024*1024;
         gl2psBeginPage("Agros2D", "Agros2D - export", NULL, format,
-                       GL2PS_BSP_SORT, options,
-                       GL_RGBA, 0, NULL, 0, 0, 0, buffsize, fp, "xxx.pdf");
+                       GL2PS_SIMPLE_SORT, options,
+                       GL_RGBA, 0, NULL, 0, 0, 0, buffsize, fp, fileName.toStdString().c_str());
 
         glClearColor(Util::config()->colorBackground.redF(),
                      Util::config()->colorBackground.greenF(),
                      Util::config()->colorBackground.blueF(), 0);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // paintSolutionMesh();
-        // paintInitialMesh();
-
         paintGeometry();
 
         state = gl2psEndPage();
+        buffsize *= 2;
     }
     fclose(fp);
 
-    // restore viewport
-    m_sceneMode = sceneMode;
-    if (m_sceneMode == SceneGeometryMode_OperateOnNodes) actOperateOnNodes->trigger();
-
     return ErrorResult();
 }
@@ -22,6 +22,7 @@
 
 #include "util.h"
 #include "sceneview_common3d.h"
+#include "util/vectorexport.h"
 
 class SceneViewPreprocessor : public SceneViewCommon3D
 {
@@ -82,6 +83,11 @@ private:
 
     void createActionsGeometry();
     void createMenuGeometry();
+
+    // native streaming export (nodes are projected and culled without OpenGL feedback)
+    ErrorResult exportGeometry(const QString &fileName, VectorExportFormat format);
+    // other formats of gl2ps
+    ErrorResult exportGeometryGL2PS(const QString &fileName, int format);
 };
 
 #endif // SCENEVIEWGEOMETRY_H
@@ -27,17 +27,23 @@
 #include "logview.h"
 
 #include "field/problem.h"
+#include "field/particletracing.h"
 
 PostView::PostView()
 {
+    m_particleTracing = new ParticleTracing();
+
     connect(Util::scene(), SIGNAL(cleared()), this, SLOT(clear()));
 
     connect(Util::problem(), SIGNAL(solved()), this, SLOT(refresh()));
+    connect(Util::problem(), SIGNAL(solutionRefined(int)), this, SLOT(refresh()));
 }
 
 PostView::~PostView()
 {
     clear();
+
+    delete m_particleTracing;
 }
 
 void PostView::refresh()
@@ -52,12 +58,31 @@ void PostView::refresh()
 
 void PostView::clear()
 {
+    m_particleTracing->clear();
 }
 
-void PostView::processSolved()
+void PostView::processParticleTracing()
 {
-    // processParticleTracing();
+    if (Util::config()->showPost3D != SceneViewPost3DMode_ParticleTracing)
+        return;
+
+    QTime time;
+    time.start();
+
+    m_particleTracing->setGrid(Util::problem()->solution());
+    m_particleTracing->setParticleCount(Util::config()->particleNumberOfParticles);
+    m_particleTracing->setMaximumSteps(Util::config()->particleMaximumSteps);
+    m_particleTracing->trace();
 
+    Util::log()->printDebug(tr("PostView"), tr("particle tracing: %1 particles (%2 points) in %3 ms").
+                            arg(m_particleTracing->paths().pathCount()).
+                            arg(m_particleTracing->paths().velocities.size()).
+                            arg(time.elapsed()));
+}
+
+void PostView::processSolved()
+{
+    processParticleTracing();
 }
 
 // ************************************************************************************************
@@ -252,8 +277,8 @@ void SceneViewPostInterface::paintScalarFieldColorBar(double min, double max)
 
     loadProjectionViewPort();
 
-    glScaled(2.0 / width(), 2.0 / height(), 1.0);
-    glTranslated(-width() / 2.0, -height() / 2.0, 0.0);
+    glScaled(2.0 / contextWidth(), 2.0 / contextHeight(), 1.0);
+    glTranslated(-contextWidth() / 2.0, -contextHeight() / 2.0, 0.0);
 
     // scene font metrics
     QFontMetrics metrics = QFontMetrics(Util::config()->sceneFont);
@@ -263,7 +288,7 @@ void SceneViewPostInterface::paintScalarFieldColorBar(double min, double max)
     int textHeight = metrics.height();
     Point scaleSize = Point(45.0 + textWidth, 20*textHeight); // height() - 20.0
     Point scaleBorder = Point(10.0, 10.0);
-    double scaleLeft = (width() - (45.0 + textWidth));
+    double scaleLeft = (contextWidth() - (45.0 + textWidth));
     int numTicks = 11;
 
     // blended rectangle
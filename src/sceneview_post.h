@@ -24,6 +24,7 @@
 #include "sceneview_common.h"
 
 template <typename Scalar> class SceneSolution;
+class ParticleTracing;
 
 class PostView : public QObject
 {
@@ -33,6 +34,8 @@ public:
     PostView();
     ~PostView();
 
+    inline ParticleTracing *particleTracing() const { return m_particleTracing; }
+
 signals:
     void processed();
 
@@ -41,6 +44,9 @@ public slots:
     void clear();
 
 private:
+    ParticleTracing *m_particleTracing;
+
+    void processParticleTracing();
 
 private slots:
     void processSolved();
@@ -21,6 +21,9 @@
 #include "util.h"
 #include "scene.h"
 #include "field/problem.h"
+#include "field/solutiongrid.h"
+#include "field/isosurface.h"
+#include "field/particletracing.h"
 #include "logview.h"
 
 #include "scenebasic.h"
@@ -54,6 +57,8 @@ SceneViewPost3D::SceneViewPost3D(PostView *postHermes, QWidget *parent)
     m_listParticleTracing(-1),
     m_listModel(-1)
 {
+    m_isoSurface = new IsoSurface();
+
     createActionsPost3D();
 
     connect(Util::scene(), SIGNAL(defaultValues()), this, SLOT(clear()));
@@ -64,6 +69,7 @@ SceneViewPost3D::SceneViewPost3D(PostView *postHermes, QWidget *parent)
 
 SceneViewPost3D::~SceneViewPost3D()
 {
+    delete m_isoSurface;
 }
 
 void SceneViewPost3D::createActionsPost3D()
@@ -81,7 +87,7 @@ void SceneViewPost3D::mousePressEvent(QMouseEvent *event)
 
 void SceneViewPost3D::paintGL()
 {
-    if (!isVisible()) return;
+    if (!isRenderable()) return;
     makeCurrent();
 
     glClearColor(Util::config()->colorBackground.redF(),
@@ -93,10 +99,14 @@ void SceneViewPost3D::paintGL()
     if (Util::problem()->isSolved())
     {
         if (Util::config()->showPost3D == SceneViewPost3DMode_ScalarView3D) paintScalarField3D();
+        if (Util::config()->showPost3D == SceneViewPost3DMode_ParticleTracing) paintParticleTracing();
 
         // bars
         if (Util::config()->showPost3D == SceneViewPost3DMode_ScalarView3D)
-            paintScalarFieldColorBar(-1, 1);
+            paintScalarFieldColorBar(m_isoSurface->min(), m_isoSurface->max());
+        if (Util::config()->showPost3D == SceneViewPost3DMode_ParticleTracing)
+            paintScalarFieldColorBar(m_postHermes->particleTracing()->velocityMin(),
+                                     m_postHermes->particleTracing()->velocityMax());
     }
 
     switch (Util::config()->showPost3D)
@@ -152,6 +162,10 @@ void SceneViewPost3D::paintScalarField3D()
 
         glEnable(GL_DEPTH_TEST);
 
+        // isosurfaces
+        updateIsoSurfaces();
+        paintIsoSurfaces();
+
         glEndList();
 
         glCallList(m_listScalarField3D);
@@ -162,6 +176,119 @@ void SceneViewPost3D::paintScalarField3D()
     }
 }
 
+void SceneViewPost3D::paintParticleTracing()
+{
+    if (!Util::problem()->isSolved()) return;
+
+    loadProjection3d(true);
+
+    if (m_listParticleTracing == -1)
+    {
+        m_listParticleTracing = glGenLists(1);
+        glNewList(m_listParticleTracing, GL_COMPILE);
+
+        // gradient background
+        paintBackground();
+
+        glEnable(GL_DEPTH_TEST);
+
+        const ParticleTracing *particleTracing = m_postHermes->particleTracing();
+        const ParticleTracingPaths &paths = particleTracing->paths();
+
+        if (paths.pathCount() > 0)
+        {
+            // colors by velocity magnitude
+            double range = particleTracing->velocityMax() - particleTracing->velocityMin();
+            QVector<float> colors(3 * paths.velocities.size());
+            for (int i = 0; i < paths.velocities.size(); i++)
+            {
+                const double *color = paletteColor((range > EPS_ZERO) ? (paths.velocities[i] - particleTracing->velocityMin()) / range : 0.0);
+                colors[3 * i + 0] = color[0];
+                colors[3 * i + 1] = color[1];
+                colors[3 * i + 2] = color[2];
+            }
+
+            glLineWidth(1.5);
+
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glEnableClientState(GL_COLOR_ARRAY);
+            glVertexPointer(3, GL_FLOAT, 0, paths.vertices.constData());
+            glColorPointer(3, GL_FLOAT, 0, colors.constData());
+
+            for (int path = 0; path < paths.pathCount(); path++)
+                if (paths.count(path) > 1)
+                    glDrawArrays(GL_LINE_STRIP, paths.first(path), paths.count(path));
+
+            glDisableClientState(GL_COLOR_ARRAY);
+            glDisableClientState(GL_VERTEX_ARRAY);
+
+            glLineWidth(1.0);
+        }
+
+        glEndList();
+
+        glCallList(m_listParticleTracing);
+    }
+    else
+    {
+        glCallList(m_listParticleTracing);
+    }
+}
+
+void SceneViewPost3D::updateIsoSurfaces()
+{
+    // derived quantities are computed here at first display
+    m_isoSurface->setGrid(Util::problem()->quantity(Util::config()->scalarVariable));
+
+    // isovalues are spread uniformly inside the range of values
+    QList<double> isoValues;
+    int count = Util::config()->isoSurfacesCount;
+    for (int i = 0; i < count; i++)
+        isoValues.append(m_isoSurface->min() + (i + 1.0) / (count + 1.0) * (m_isoSurface->max() - m_isoSurface->min()));
+
+    m_isoSurface->setIsoValues(isoValues);
+    m_isoSurface->update();
+}
+
+void SceneViewPost3D::paintIsoSurfaces()
+{
+    double range = m_isoSurface->max() - m_isoSurface->min();
+
+    initLighting();
+    glEnable(GL_COLOR_MATERIAL);
+    glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+    glLightModeli(GL_LIGHT_MODEL_TWO_SIDE, GL_TRUE);
+
+    // nested surfaces are translucent
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDepthMask(GL_FALSE);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+
+    foreach (IsoSurfaceMeshPointer mesh, m_isoSurface->meshes())
+    {
+        if (mesh->triangleCount() == 0)
+            continue;
+
+        const double *color = paletteColor((range > EPS_ZERO) ? (mesh->isoValue - m_isoSurface->min()) / range : 0.5);
+        glColor4d(color[0], color[1], color[2], 0.6);
+
+        glVertexPointer(3, GL_FLOAT, 0, mesh->vertices.constData());
+        glNormalPointer(GL_FLOAT, 0, mesh->normals.constData());
+        glDrawElements(GL_TRIANGLES, mesh->indices.size(), GL_UNSIGNED_INT, mesh->indices.constData());
+    }
+
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glDisable(GL_COLOR_MATERIAL);
+    glDisable(GL_LIGHTING);
+}
+
 void SceneViewPost3D::refresh()
 {
     if (m_listScalarField3D != -1) glDeleteLists(m_listScalarField3D, 1);
@@ -183,5 +310,7 @@ void SceneViewPost3D::refresh()
 
 void SceneViewPost3D::clear()
 {
+    m_isoSurface->clear();
+
     SceneViewCommon3D::clear();
 }
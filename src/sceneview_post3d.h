@@ -25,6 +25,7 @@
 
 template <typename Scalar> class SceneSolution;
 template <typename Scalar> class ViewScalarFilter;
+class IsoSurface;
 
 class SceneViewPost3D : public SceneViewCommon3D
 {
@@ -51,7 +52,8 @@ protected:
     virtual void resizeGL(int w, int h);
 
     void paintScalarField3D(); // paint scalar field 3d surface
-    void paintParticleTracing(); // paint scalar field contours
+    void paintIsoSurfaces(); // paint isosurfaces of the scalar field
+    void paintParticleTracing(); // paint particle trajectories
 
 private:
     // gl lists
@@ -59,7 +61,11 @@ private:
     int m_listParticleTracing;
     int m_listModel;
 
+    // isosurfaces (cached between refreshes)
+    IsoSurface *m_isoSurface;
+
     void createActionsPost3D();
+    void updateIsoSurfaces();
 
 private slots:
     virtual void refresh();
@@ -57,12 +57,18 @@ void SettingsWidget::load()
 
     chkZoomToMouse->setChecked(Util::config()->zoomToMouse);
     txtGeometryNodeSize->setValue(Util::config()->nodeSize);
+    txtGeometryTolerance->setNumber(Util::config()->geometryTolerance);
 
     // 3d
     chkView3DLighting->setChecked(Util::config()->scalarView3DLighting);
     txtView3DAngle->setValue(Util::config()->scalarView3DAngle);
     chkView3DBackground->setChecked(Util::config()->scalarView3DBackground);
 
+    // solver
+    chkSolverProgressive->setChecked(Util::config()->solverProgressive);
+    chkSolverIncremental->setChecked(Util::config()->solverIncremental);
+    txtSolverGridLevels->setValue(Util::config()->solverGridLevels);
+
     // colors
     colorBackground->setColor(Util::config()->colorBackground);
     colorGrid->setColor(Util::config()->colorGrid);
@@ -88,6 +94,8 @@ void SettingsWidget::save()
     Util::config()->showAxes = chkShowAxes->isChecked();
 
     Util::config()->nodeSize = txtGeometryNodeSize->value();
+    if (txtGeometryTolerance->evaluate(true))
+        Util::config()->geometryTolerance = txtGeometryTolerance->number();
 
     // color
     Util::config()->colorBackground = colorBackground->color();
@@ -108,6 +116,11 @@ void SettingsWidget::save()
     Util::config()->scalarView3DAngle = txtView3DAngle->value();
     Util::config()->scalarView3DBackground = chkView3DBackground->isChecked();
 
+    // solver
+    Util::config()->solverProgressive = chkSolverProgressive->isChecked();
+    Util::config()->solverIncremental = chkSolverIncremental->isChecked();
+    Util::config()->solverGridLevels = txtSolverGridLevels->value();
+
     // save
     Util::config()->save();
 }
@@ -177,10 +190,14 @@ QWidget *SettingsWidget::controlsWorkspace()
     txtGeometryNodeSize = new QSpinBox();
     txtGeometryNodeSize->setMinimum(1);
     txtGeometryNodeSize->setMaximum(20);
+    txtGeometryTolerance = new ValueLineEdit();
+    txtGeometryTolerance->setMinimumSharp(0.0);
 
     QGridLayout *layoutGeometry = new QGridLayout();
     layoutGeometry->addWidget(new QLabel(tr("Node size:")), 0, 0);
     layoutGeometry->addWidget(txtGeometryNodeSize, 0, 1);
+    layoutGeometry->addWidget(new QLabel(tr("Tolerance of duplicate nodes (m):")), 1, 0);
+    layoutGeometry->addWidget(txtGeometryTolerance, 1, 1);
 
     QGroupBox *grpGeometry = new QGroupBox(tr("Geometry"));
     grpGeometry->setLayout(layoutGeometry);
@@ -232,12 +249,29 @@ QWidget *SettingsWidget::controlsAdvanced()
     QGroupBox *grp3D = new QGroupBox(tr("3D view"));
     grp3D->setLayout(layout3D);
 
+    // layout solver
+    chkSolverProgressive = new QCheckBox(tr("Progressive solution (coarse to fine)"), this);
+    chkSolverIncremental = new QCheckBox(tr("Update solution after geometry edits"), this);
+    txtSolverGridLevels = new QSpinBox(this);
+    txtSolverGridLevels->setMinimum(SOLVERGRIDLEVELSMIN);
+    txtSolverGridLevels->setMaximum(SOLVERGRIDLEVELSMAX);
+
+    QGridLayout *layoutSolver = new QGridLayout();
+    layoutSolver->addWidget(new QLabel(tr("Refinement levels:")), 0, 0);
+    layoutSolver->addWidget(txtSolverGridLevels, 0, 1);
+    layoutSolver->addWidget(chkSolverProgressive, 1, 0, 1, 2);
+    layoutSolver->addWidget(chkSolverIncremental, 2, 0, 1, 2);
+
+    QGroupBox *grpSolver = new QGroupBox(tr("Solver"));
+    grpSolver->setLayout(layoutSolver);
+
     QPushButton *btnAdvancedDefault = new QPushButton(tr("Default"));
     connect(btnAdvancedDefault, SIGNAL(clicked()), this, SLOT(doAdvancedDefault()));
 
     // layout postprocessor
     QVBoxLayout *layoutAdvanced = new QVBoxLayout();
     layoutAdvanced->addWidget(grp3D);
+    layoutAdvanced->addWidget(grpSolver);
     layoutAdvanced->addStretch();
     layoutAdvanced->addWidget(btnAdvancedDefault, 0, Qt::AlignLeft);
 
@@ -342,6 +376,7 @@ void SettingsWidget::doWorkspaceDefault()
 
     chkZoomToMouse->setChecked(ZOOMTOMOUSE);
     txtGeometryNodeSize->setValue(GEOMETRYNODESIZE);
+    txtGeometryTolerance->setNumber(SCENEVALIDATIONTOLERANCE);
 }
 
 void SettingsWidget::doAdvancedDefault()
@@ -349,6 +384,10 @@ void SettingsWidget::doAdvancedDefault()
     chkView3DLighting->setChecked(VIEW3DLIGHTING);
     txtView3DAngle->setValue(VIEW3DANGLE);
     chkView3DBackground->setChecked(VIEW3DBACKGROUND);
+
+    chkSolverProgressive->setChecked(SOLVERPROGRESSIVE);
+    chkSolverIncremental->setChecked(SOLVERINCREMENTAL);
+    txtSolverGridLevels->setValue(SOLVERGRIDLEVELS);
 }
 
 void SettingsWidget::doColorsDefault()
@@ -45,6 +45,7 @@ private:
     // general view
     QCheckBox *chkZoomToMouse;
     QSpinBox *txtGeometryNodeSize;
+    ValueLineEdit *txtGeometryTolerance;
 
     // scene font
     QLabel *lblSceneFontExample;
@@ -58,6 +59,11 @@ private:
     QDoubleSpinBox *txtView3DAngle;
     QCheckBox *chkView3DBackground;
 
+    // solver
+    QCheckBox *chkSolverProgressive;
+    QCheckBox *chkSolverIncremental;
+    QSpinBox *txtSolverGridLevels;
+
     // colors
     ColorButton *colorBackground;
     ColorButton *colorGrid;
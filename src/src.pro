@@ -28,6 +28,10 @@ SOURCES += util.cpp \
     util/checkversion.cpp \
     util/point.cpp \
     util/xml.cpp \
+    util/vectorexport.cpp \
+    util/datatablewriter.cpp \
+    util/spatialhash.cpp \
+    util/pointgenerator.cpp \
     gui/common.cpp \
     gui/chart.cpp \
     gui/filebrowser.cpp \
@@ -54,6 +58,17 @@ SOURCES += util.cpp \
     sceneview_post3d.cpp \
     chartdialog.cpp \    
     field/problem.cpp \
+    field/solutiongrid.cpp \
+    field/solutionstore.cpp \
+    field/isosurface.cpp \
+    field/particletracing.cpp \
+    field/solver.cpp \
+    field/linesampler.cpp \
+    field/localvalueprobe.cpp \
+    field/fieldinterpolator.cpp \
+    field/integralvalue.cpp \
+    field/statistics.cpp \
+    field/derivedquantity.cpp \
     problemdialog.cpp \
     scenetransformdialog.cpp \
     tooltipview.cpp \
@@ -68,10 +83,14 @@ SOURCES += util.cpp \
     conf.cpp \
     confdialog.cpp \
     scenenode.cpp \
+    scenesnapshot.cpp \
+    scenevalidation.cpp \
     preprocessorview.cpp \
+    preprocessormodel.cpp \
     infowidget.cpp \
     settings.cpp \
     parser/lex.cpp \
+    parser/expression.cpp \
     gui/groupbox.cpp
 
 HEADERS += util.h \
@@ -81,6 +100,10 @@ HEADERS += util.h \
     util/checkversion.h \
     util/point.h \
     util/xml.h \
+    util/vectorexport.h \
+    util/datatablewriter.h \
+    util/spatialhash.h \
+    util/pointgenerator.h \
     gui/common.h \
     gui/chart.h \
     gui/filebrowser.h \
@@ -100,6 +123,8 @@ HEADERS += util.h \
     mainwindow.h \
     scenebasic.h \
     scenenode.h \
+    scenesnapshot.h \
+    scenevalidation.h \
     sceneview_data.h \
     sceneview_common.h \
     sceneview_common3d.h \
@@ -111,6 +136,18 @@ HEADERS += util.h \
     meshgenerator_gmsh.h \
     chartdialog.h \
     field/problem.h \
+    field/solutiongrid.h \
+    field/solutionstore.h \
+    field/isosurface.h \
+    field/isosurface_data.h \
+    field/particletracing.h \
+    field/solver.h \
+    field/linesampler.h \
+    field/localvalueprobe.h \
+    field/fieldinterpolator.h \
+    field/integralvalue.h \
+    field/statistics.h \
+    field/derivedquantity.h \
     problemdialog.h \
     scenetransformdialog.h \
     reportdialog.h \
@@ -126,9 +163,11 @@ HEADERS += util.h \
     conf.h \
     confdialog.h \
     preprocessorview.h \
+    preprocessormodel.h \
     infowidget.h \
     settings.h \
     parser/lex.h \
+    parser/expression.h \
     gui/groupbox.h
 
 OTHER_FILES += python/field.pyx \
@@ -153,6 +192,23 @@ OTHER_FILES += python/field.pyx \
     ../resources/xsd/mesh_h2d_xml.xsd \
     ../resources/xsd/coupling_xml.xsd
 
+# variable names of the panel templates (ctemplate::StaticTemplateString with precomputed hashes)
+# are generated at build time by the bundled make_tpl_varnames_h
+TEMPLATES_PANELS = ../resources/templates/panels/local_point_values.tpl \
+    ../resources/templates/panels/style.tpl \
+    ../resources/templates/panels/empty.tpl \
+    ../resources/templates/panels/problem.tpl \
+    ../resources/templates/panels/problem_style.tpl
+
+varnames.input = TEMPLATES_PANELS
+varnames.output = build/${QMAKE_FILE_BASE}.tpl.varnames.h
+varnames.commands = ../3rdparty/make_tpl_varnames_h/make_tpl_varnames_h -q -t../resources/templates/panels -obuild/ ${QMAKE_FILE_BASE}.tpl
+varnames.depends = ../3rdparty/make_tpl_varnames_h/make_tpl_varnames_h
+varnames.CONFIG += no_link target_predeps
+QMAKE_EXTRA_COMPILERS += varnames
+
+INCLUDEPATH += build
+
 LIBS += -lfield_3rdparty
 
 linux-g++|linux-g++-64|linux-g++-32 {
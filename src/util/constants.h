@@ -81,6 +81,10 @@ const int SCALARDECIMALPLACEMIN = 0;
 const int SCALARDECIMALPLACEMAX = 10;
 const int CONTOURSCOUNTMIN = 1;
 const int CONTOURSCOUNTMAX = 100;
+const int ISOSURFACESCOUNTMIN = 1;
+const int ISOSURFACESCOUNTMAX = 50;
+const int PARTICLENUMBEROFPARTICLESMIN = 1;
+const int PARTICLENUMBEROFPARTICLESMAX = 100000;
 const int VECTORSCOUNTMIN = 1;
 const int VECTORSCOUNTMAX = 500;
 const double VECTORSSCALEMIN = 0.1;
@@ -88,6 +92,9 @@ const double VECTORSSCALEMAX = 20.0;
 
 // post3d
 const SceneViewPost3DMode SCALARSHOWPOST3D = SceneViewPost3DMode_ScalarView3D;
+const int ISOSURFACESCOUNT = 5;
+const int PARTICLENUMBEROFPARTICLES = 500;
+const int PARTICLEMAXIMUMSTEPS = 1000;
 
 const bool SHOWCONTOURVIEW = false;
 const int CONTOURSCOUNT = 15;
@@ -110,6 +117,67 @@ const bool VIEW3DLIGHTING = false;
 const double VIEW3DANGLE = 230.0;
 const bool VIEW3DBACKGROUND = true;
 
+// solver
+const bool SOLVERPROGRESSIVE = true;
+const bool SOLVERINCREMENTAL = true;
+// incremental solve is used up to this number of changed sources relative to all sources
+const double SOLVERINCREMENTALFRACTION = 0.25;
+const int SOLVERGRIDCOARSE = 8;
+const int SOLVERGRIDLEVELS = 4;
+const int SOLVERGRIDLEVELSMIN = 0;
+const int SOLVERGRIDLEVELSMAX = 6;
+
+// chart
+const int CHARTINITIALPOINTS = 17;
+const int CHARTMAXIMUMPOINTS = 2000;
+const int CHARTMAXIMUMLEVELS = 12;
+const double CHARTTOLERANCE = 1e-3;
+
+// interpolation of the solution (relative error)
+const double FIELDINTERPOLATORTOLERANCE = 1e-3;
+// up to this number of sources the values are evaluated directly
+const int FIELDINTERPOLATORDIRECTSOURCES = 64;
+
+// integral values (maximum number of Gauss intervals along an edge)
+const int INTEGRALMAXIMUMSUBDIVISION = 16;
+// relative rounding error of the running totals accepted by the debug check against the sum of contributions
+const double INTEGRALCHECKTOLERANCE = 1e-9;
+
+// statistics of the solution (bins of the histogram, values reduced per parallel chunk)
+const int STATISTICSBINS = 4096;
+const int STATISTICSCHUNK = 65536;
+
+// expressions (values evaluated per instruction at once)
+const int EXPRESSIONBLOCK = 256;
+
+// local values (interval in ms, about one display frame)
+const int PROBEINTERVAL = 16;
+const int PROBECACHESIZE = 1000;
+
+// coincident points (same tolerance as Point3::operator==), smallest cell of the spatial hash
+const double SPATIALHASHTOLERANCE = 1e-12;
+const double SPATIALHASHCELLMIN = 1e-9;
+
+// geometry validation (default tolerance of coincident nodes, largest coordinate the kernels can be evaluated in)
+const double SCENEVALIDATIONTOLERANCE = 1e-12;
+const double SCENEVALIDATIONRANGE = 1e150;
+
+// geometry generators (maximum number of points of one generator)
+const int SCENEGENERATORMAXIMUM = 100000000;
+
+// preprocessor tree (node rows fetched at once, largest number of blocks of rows updated without a reset,
+// delay of the filter after the last key press in ms)
+const int PREPROCESSORFETCHCHUNK = 1000;
+const int PREPROCESSORMAXIMUMBLOCKS = 64;
+const int PREPROCESSORFILTERDELAY = 300;
+
+// scene snapshots (nodes per shared chunk, by id)
+const int SCENESNAPSHOTCHUNK = 1024;
+
+// undo history (maximum number of commands, payload of older commands is compressed above the budget in bytes)
+const int UNDOLIMIT = 1000;
+const int UNDOMEMORYBUDGET = 64 * 1024 * 1024;
+
 // command argument
 const QString COMMANDS_TRIANGLE = "%1 -p -P -q31.0 -e -A -a -z -Q -I -n -o2 \"%2\"";
 
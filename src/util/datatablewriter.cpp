@@ -0,0 +1,241 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "datatablewriter.h"
+
+// size of the output block
+const int BUFFER_SIZE = 256 * 1024;
+
+// rows of the binary output converted at once
+const int BINARY_BLOCK_ROWS = 1024;
+
+DataTableWriter::DataTableWriter(DataTableFormat format)
+    : m_format(format), m_position(0), m_failed(false)
+{
+}
+
+DataTableWriter::~DataTableWriter()
+{
+    if (m_file.isOpen())
+        m_file.close();
+}
+
+DataTableFormat DataTableWriter::formatFromSuffix(const QString &suffix)
+{
+    QString lower = suffix.toLower();
+    if (lower == "m")
+        return DataTableFormat_Matlab;
+    if (lower == "bin")
+        return DataTableFormat_Binary;
+    if (lower == "npy")
+        return DataTableFormat_NPY;
+
+    return DataTableFormat_CSV;
+}
+
+QString DataTableWriter::suffix(DataTableFormat format)
+{
+    switch (format)
+    {
+    case DataTableFormat_Matlab:
+        return "m";
+    case DataTableFormat_Binary:
+        return "bin";
+    case DataTableFormat_NPY:
+        return "npy";
+    default:
+        return "csv";
+    }
+}
+
+QString DataTableWriter::filter(DataTableFormat format)
+{
+    switch (format)
+    {
+    case DataTableFormat_Matlab:
+        return QObject::tr("Matlab/Octave script (*.m)");
+    case DataTableFormat_Binary:
+        return QObject::tr("Binary files (*.bin)");
+    case DataTableFormat_NPY:
+        return QObject::tr("NumPy arrays (*.npy)");
+    default:
+        return QObject::tr("CSV files (*.csv)");
+    }
+}
+
+void DataTableWriter::addColumn(const QString &name, const double *values)
+{
+    m_names.append(name);
+    m_values.append(values);
+}
+
+bool DataTableWriter::write(const QString &fileName, int rows)
+{
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::WriteOnly))
+        return false;
+
+    m_buffer.resize(BUFFER_SIZE);
+    m_position = 0;
+    m_failed = false;
+
+    switch (m_format)
+    {
+    case DataTableFormat_CSV:
+        writeCSV(rows);
+        break;
+    case DataTableFormat_Matlab:
+        writeMatlab(rows);
+        break;
+    case DataTableFormat_Binary:
+        writeBinary(rows);
+        break;
+    case DataTableFormat_NPY:
+        writeNPYHeader(rows);
+        writeBinary(rows);
+        break;
+    }
+
+    flush();
+    m_file.close();
+    m_buffer.clear();
+
+    return !m_failed;
+}
+
+void DataTableWriter::write(const char *data, int size)
+{
+    if (m_position + size > m_buffer.size())
+    {
+        flush();
+
+        // larger than the whole block
+        if (size > m_buffer.size())
+        {
+            if (m_file.write(data, size) != size)
+                m_failed = true;
+            return;
+        }
+    }
+
+    memcpy(m_buffer.data() + m_position, data, size);
+    m_position += size;
+}
+
+void DataTableWriter::writeNumber(double value)
+{
+    char text[32];
+    int size = qsnprintf(text, sizeof(text), "%.17g", value);
+
+    // independent of the locale of the application
+    for (int i = 0; i < size; i++)
+        if (text[i] == ',')
+            text[i] = '.';
+
+    write(text, size);
+}
+
+void DataTableWriter::flush()
+{
+    if (m_position == 0)
+        return;
+
+    if (m_file.write(m_buffer.constData(), m_position) != m_position)
+        m_failed = true;
+    m_position = 0;
+}
+
+void DataTableWriter::writeCSV(int rows)
+{
+    foreach (QString name, m_names)
+        write((name + ";").toUtf8());
+    write("\n", 1);
+
+    for (int i = 0; i < rows; i++)
+    {
+        for (int j = 0; j < m_values.count(); j++)
+        {
+            writeNumber(m_values[j][i]);
+            write(";", 1);
+        }
+        write("\n", 1);
+    }
+}
+
+void DataTableWriter::writeMatlab(int rows)
+{
+    for (int j = 0; j < m_values.count(); j++)
+    {
+        QString name = m_names[j];
+        write((name.replace(" ", "_") + " = [").toUtf8());
+
+        const double *values = m_values[j];
+        for (int i = 0; i < rows; i++)
+        {
+            if (i > 0)
+                write(", ", 2);
+            writeNumber(values[i]);
+        }
+        write("];\n", 3);
+    }
+}
+
+void DataTableWriter::writeBinary(int rows)
+{
+    int columns = m_values.count();
+    QVector<double> block(BINARY_BLOCK_ROWS * columns);
+
+    // interleave the columns into rows
+    for (int first = 0; first < rows; first += BINARY_BLOCK_ROWS)
+    {
+        int count = qMin(BINARY_BLOCK_ROWS, rows - first);
+        double *data = block.data();
+
+        for (int j = 0; j < columns; j++)
+        {
+            const double *values = m_values[j] + first;
+            for (int i = 0; i < count; i++)
+                data[i * columns + j] = values[i];
+        }
+
+        write((const char *) data, count * columns * sizeof(double));
+    }
+}
+
+void DataTableWriter::writeNPYHeader(int rows)
+{
+#if Q_BYTE_ORDER == Q_BIG_ENDIAN
+    QByteArray descr = ">f8";
+#else
+    QByteArray descr = "<f8";
+#endif
+
+    QByteArray header = "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" +
+            QByteArray::number(rows) + ", " + QByteArray::number(m_values.count()) + "), }";
+
+    // magic, version and header length precede the header, the data start is aligned to 64 bytes
+    int length = 10 + header.size() + 1;
+    header.append(QByteArray((64 - length % 64) % 64, ' '));
+    header.append('\n');
+
+    write("\x93NUMPY\x01\x00", 8);
+    char size[2] = { (char) (header.size() & 0xff), (char) (header.size() >> 8) };
+    write(size, 2);
+    write(header);
+}
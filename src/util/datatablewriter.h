@@ -0,0 +1,77 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef UTIL_DATATABLEWRITER_H
+#define UTIL_DATATABLEWRITER_H
+
+#include <QtCore>
+
+enum DataTableFormat
+{
+    DataTableFormat_CSV,
+    DataTableFormat_Matlab,
+    DataTableFormat_Binary,
+    DataTableFormat_NPY
+};
+
+/// streaming writer of numeric columns of the same length
+/// csv - header and rows separated by semicolons, matlab - one vector per column,
+/// binary - rows of float64 values in the byte order of the machine without any header,
+/// npy - float64 matrix (rows x columns) readable by numpy.load()
+/// values are formatted directly into the output blocks, the columns are referenced, not copied
+class DataTableWriter
+{
+public:
+    DataTableWriter(DataTableFormat format);
+    ~DataTableWriter();
+
+    /// values have to stay valid until write() finishes
+    void addColumn(const QString &name, const double *values);
+    inline int columnCount() const { return m_values.count(); }
+
+    bool write(const QString &fileName, int rows);
+    inline QString errorString() const { return m_file.errorString(); }
+
+    static DataTableFormat formatFromSuffix(const QString &suffix);
+    static QString suffix(DataTableFormat format);
+    static QString filter(DataTableFormat format);
+
+private:
+    DataTableFormat m_format;
+
+    QStringList m_names;
+    QList<const double *> m_values;
+
+    QFile m_file;
+    QByteArray m_buffer;
+    int m_position;
+    bool m_failed;
+
+    void write(const char *data, int size);
+    inline void write(const QByteArray &data) { write(data.constData(), data.size()); }
+    void writeNumber(double value);
+    void flush();
+
+    void writeCSV(int rows);
+    void writeMatlab(int rows);
+    void writeBinary(int rows);
+    void writeNPYHeader(int rows);
+};
+
+#endif // UTIL_DATATABLEWRITER_H
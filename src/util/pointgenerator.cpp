@@ -0,0 +1,157 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "pointgenerator.h"
+
+/// parameter of the i-th of count samples from 0 to 1 (both included)
+static inline double sample(int i, int count)
+{
+    return (count > 1) ? double(i) / (count - 1) : 0.0;
+}
+
+QVector<Point3> PointGenerator::lattice(const Point3 &origin, const Point3 &step, int nx, int ny, int nz)
+{
+    int count = nx * ny * nz;
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int n = 0; n < count; n++)
+    {
+        int i = n % nx;
+        int j = (n / nx) % ny;
+        int k = n / (nx * ny);
+
+        p[n] = Point3(origin.x + i * step.x, origin.y + j * step.y, origin.z + k * step.z);
+    }
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::polar(const Point3 &center, double r0, double r1, int nr, int na, double angle)
+{
+    return cylindrical(center, r0, r1, nr, na, 0.0, 1, angle);
+}
+
+QVector<Point3> PointGenerator::cylindrical(const Point3 &center, double r0, double r1, int nr, int na,
+                                            double dz, int nz, double angle)
+{
+    int count = nr * na * nz;
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int n = 0; n < count; n++)
+    {
+        int a = n % na;
+        int r = (n / na) % nr;
+        int k = n / (na * nr);
+
+        double radius = r0 + (r1 - r0) * sample(r, nr);
+        double phi = (angle + 360.0 * a / na) / 180.0 * M_PI;
+
+        p[n] = Point3(center.x + radius * cos(phi), center.y + radius * sin(phi), center.z + k * dz);
+    }
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::line(const Point3 &start, const Point3 &end, int count)
+{
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+        p[i] = start + (end - start) * sample(i, count);
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::circle(const Point3 &center, const Point3 &normal, double radius, int count)
+{
+    // orthonormal basis of the plane (u never vanishes for a non-zero normal)
+    Point3 n = normal.normalizePoint();
+    Point3 u = (fabs(n.z) > fabs(n.x)) ? Point3(0.0, -n.z, n.y) : Point3(-n.y, n.x, 0.0);
+    u = u.normalizePoint();
+    Point3 v(n.y * u.z - n.z * u.y, n.z * u.x - n.x * u.z, n.x * u.y - n.y * u.x);
+
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+    {
+        double phi = 2.0 * M_PI * i / count;
+        p[i] = center + u * (radius * cos(phi)) + v * (radius * sin(phi));
+    }
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::helix(const Point3 &center, double radius, double pitch, double turns, int count)
+{
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+    {
+        double t = turns * sample(i, count);
+        double phi = 2.0 * M_PI * t;
+
+        p[i] = Point3(center.x + radius * cos(phi), center.y + radius * sin(phi), center.z + pitch * t);
+    }
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::plane(const Point3 &origin, const Point3 &u, const Point3 &v, int nu, int nv)
+{
+    int count = nu * nv;
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int n = 0; n < count; n++)
+        p[n] = origin + u * sample(n % nu, nu) + v * sample(n / nu, nv);
+
+    return points;
+}
+
+QVector<Point3> PointGenerator::sphere(const Point3 &center, double radius, int count)
+{
+    // golden angle between consecutive points, heights evenly spaced (equal areas)
+    double golden = M_PI * (3.0 - sqrt(5.0));
+
+    QVector<Point3> points(count);
+    Point3 *p = points.data();
+
+#pragma omp parallel for
+    for (int i = 0; i < count; i++)
+    {
+        double z = 1.0 - (2.0 * i + 1.0) / count;
+        double r = sqrt(qMax(1.0 - z * z, 0.0));
+        double phi = golden * i;
+
+        p[i] = center + Point3(r * cos(phi), r * sin(phi), z) * radius;
+    }
+
+    return points;
+}
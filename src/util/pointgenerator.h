@@ -0,0 +1,52 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef UTIL_POINTGENERATOR_H
+#define UTIL_POINTGENERATOR_H
+
+#include "point.h"
+
+/// regular sets of points, each point is computed from its index (in parallel)
+/// angles are in degrees, counts have to be positive
+class PointGenerator
+{
+public:
+    /// nx x ny x nz points origin + (i * step.x, j * step.y, k * step.z)
+    static QVector<Point3> lattice(const Point3 &origin, const Point3 &step, int nx, int ny, int nz);
+
+    /// nr rings with radii from r0 to r1 in the plane z = center.z, na points per ring starting at the angle
+    static QVector<Point3> polar(const Point3 &center, double r0, double r1, int nr, int na, double angle = 0.0);
+    /// polar array repeated nz times along z with the step dz
+    static QVector<Point3> cylindrical(const Point3 &center, double r0, double r1, int nr, int na,
+                                       double dz, int nz, double angle = 0.0);
+
+    /// count points from start to end (both included)
+    static QVector<Point3> line(const Point3 &start, const Point3 &end, int count);
+    /// count points on the circle in the plane perpendicular to the normal
+    static QVector<Point3> circle(const Point3 &center, const Point3 &normal, double radius, int count);
+    /// count points on the helix around the z axis through the center, pitch is the rise per turn
+    static QVector<Point3> helix(const Point3 &center, double radius, double pitch, double turns, int count);
+
+    /// nu x nv points of the parallelogram origin + s * u + t * v, s and t from 0 to 1 (both included)
+    static QVector<Point3> plane(const Point3 &origin, const Point3 &u, const Point3 &v, int nu, int nv);
+    /// count points evenly distributed on the sphere (Fibonacci lattice)
+    static QVector<Point3> sphere(const Point3 &center, double radius, int count);
+};
+
+#endif // UTIL_POINTGENERATOR_H
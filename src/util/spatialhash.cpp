@@ -0,0 +1,92 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "spatialhash.h"
+#include "constants.h"
+
+SpatialHash::SpatialHash(double cellSize, double tolerance) : m_cellSize(cellSize), m_tolerance(tolerance)
+{
+}
+
+double SpatialHash::cellSize(const CubePoint &box, int count)
+{
+    double size = qMax(box.width(), qMax(box.height(), box.deep()));
+
+    // cells must be larger than the tolerance
+    return qMax(size / pow(double(qMax(count, 1)), 1.0 / 3.0), SPATIALHASHCELLMIN);
+}
+
+void SpatialHash::insert(const Point3 &point, int value)
+{
+    m_cells.insert(SpatialHashCell(cell(point.x), cell(point.y), cell(point.z)), m_points.count());
+    m_points.append(point);
+    m_values.append(value);
+}
+
+int SpatialHash::find(const Point3 &point) const
+{
+    return search(point, NULL);
+}
+
+QList<int> SpatialHash::findAll(const Point3 &point) const
+{
+    QList<int> values;
+    search(point, &values);
+
+    return values;
+}
+
+int SpatialHash::search(const Point3 &point, QList<int> *values) const
+{
+    int result = -1;
+
+    // cells touched by the tolerance box around the point (one in most cases)
+    qint64 i0 = cell(point.x - m_tolerance), i1 = cell(point.x + m_tolerance);
+    qint64 j0 = cell(point.y - m_tolerance), j1 = cell(point.y + m_tolerance);
+    qint64 k0 = cell(point.z - m_tolerance), k1 = cell(point.z + m_tolerance);
+
+    for (qint64 i = i0; i <= i1; i++)
+        for (qint64 j = j0; j <= j1; j++)
+            for (qint64 k = k0; k <= k1; k++)
+            {
+                QMultiHash<SpatialHashCell, int>::const_iterator it = m_cells.constFind(SpatialHashCell(i, j, k));
+                while (it != m_cells.constEnd() && it.key() == SpatialHashCell(i, j, k))
+                {
+                    if (isCoincident(m_points[it.value()], point))
+                    {
+                        int value = m_values[it.value()];
+                        if (!values)
+                            return value;
+                        if (result == -1)
+                            result = value;
+                        values->append(value);
+                    }
+                    ++it;
+                }
+            }
+
+    return result;
+}
+
+void SpatialHash::clear()
+{
+    m_cells.clear();
+    m_points.clear();
+    m_values.clear();
+}
@@ -0,0 +1,81 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef UTIL_SPATIALHASH_H
+#define UTIL_SPATIALHASH_H
+
+#include <QtCore>
+
+#include "point.h"
+#include "constants.h"
+
+struct SpatialHashCell
+{
+    qint64 i, j, k;
+
+    SpatialHashCell(qint64 i, qint64 j, qint64 k) { this->i = i; this->j = j; this->k = k; }
+
+    inline bool operator==(const SpatialHashCell &cell) const { return (i == cell.i && j == cell.j && k == cell.k); }
+};
+
+inline uint qHash(const SpatialHashCell &cell)
+{
+    return uint(cell.i * 73856093) ^ uint(cell.j * 19349663) ^ uint(cell.k * 83492791);
+}
+
+/// points (with values) in an uniform grid of hashed cells, finds coincident points (all coordinates closer than
+/// the tolerance, Point3::operator== for the default one) in expected O(1), only cells within the tolerance are visited
+/// const methods can be called from more threads at once
+class SpatialHash
+{
+public:
+    SpatialHash(double cellSize, double tolerance = SPATIALHASHTOLERANCE);
+
+    /// cell size giving about one point per cell for count points in the box
+    static double cellSize(const CubePoint &box, int count);
+
+    void insert(const Point3 &point, int value);
+
+    /// value of a point coincident with the given one or -1
+    int find(const Point3 &point) const;
+    /// values of all points coincident with the given one
+    QList<int> findAll(const Point3 &point) const;
+
+    inline int count() const { return m_points.count(); }
+    void clear();
+
+private:
+    double m_cellSize;
+    double m_tolerance;
+
+    QMultiHash<SpatialHashCell, int> m_cells;
+    QVector<Point3> m_points;
+    QVector<int> m_values;
+
+    inline qint64 cell(double coordinate) const { return qint64(floor(coordinate / m_cellSize)); }
+    inline bool isCoincident(const Point3 &a, const Point3 &b) const
+    {
+        return (fabs(a.x - b.x) < m_tolerance) && (fabs(a.y - b.y) < m_tolerance) && (fabs(a.z - b.z) < m_tolerance);
+    }
+
+    /// value of the first point coincident with the given one or -1, all values are collected if values is set
+    int search(const Point3 &point, QList<int> *values) const;
+};
+
+#endif // UTIL_SPATIALHASH_H
@@ -0,0 +1,236 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#include "vectorexport.h"
+
+// size of the output block
+const int BUFFER_SIZE = 256 * 1024;
+
+// control point distance of the cubic Bezier approximation of a quarter circle
+const double CIRCLE_KAPPA = 0.5522847498;
+
+static inline QByteArray number(double value)
+{
+    return QByteArray::number(value, 'f', 2);
+}
+
+VectorExport::VectorExport(VectorExportFormat format, int width, int height)
+    : m_format(format), m_width(width), m_height(height), m_written(0),
+      m_color(Qt::black), m_colorChanged(true), m_groupOpened(false), m_streamStart(0)
+{
+}
+
+VectorExport::~VectorExport()
+{
+    if (m_file.isOpen())
+        m_file.close();
+}
+
+bool VectorExport::begin(const QString &fileName)
+{
+    m_file.setFileName(fileName);
+    if (!m_file.open(QIODevice::WriteOnly))
+        return false;
+
+    m_buffer.reserve(BUFFER_SIZE);
+    m_written = 0;
+    m_colorChanged = true;
+    m_groupOpened = false;
+    m_objectOffsets.clear();
+
+    switch (m_format)
+    {
+    case VectorExportFormat_SVG:
+        write("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>\n");
+        write("<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\" width=\"" + QByteArray::number(m_width) +
+              "\" height=\"" + QByteArray::number(m_height) +
+              "\" viewBox=\"0 0 " + QByteArray::number(m_width) + " " + QByteArray::number(m_height) + "\">\n");
+        write("<title>Agros2D - export</title>\n");
+        break;
+    case VectorExportFormat_EPS:
+        write("%!PS-Adobe-3.0 EPSF-3.0\n");
+        write("%%Creator: Agros2D\n");
+        write("%%BoundingBox: 0 0 " + QByteArray::number(m_width) + " " + QByteArray::number(m_height) + "\n");
+        write("%%EndComments\n");
+        write("/r { rectfill } bind def\n");
+        write("/d { newpath 0 360 arc fill } bind def\n");
+        write("/c { setrgbcolor } bind def\n");
+        break;
+    case VectorExportFormat_PDF:
+        write("%PDF-1.4\n");
+        // catalog, pages, page, content stream and its length
+        beginObject();
+        write("<< /Type /Catalog /Pages 2 0 R >>\nendobj\n");
+        beginObject();
+        write("<< /Type /Pages /Kids [3 0 R] /Count 1 >>\nendobj\n");
+        beginObject();
+        write("<< /Type /Page /Parent 2 0 R /MediaBox [0 0 " + QByteArray::number(m_width) + " " + QByteArray::number(m_height) +
+              "] /Contents 4 0 R /Resources << >> >>\nendobj\n");
+        beginObject();
+        write("<< /Length 5 0 R >>\nstream\n");
+        m_streamStart = position();
+        break;
+    }
+
+    return true;
+}
+
+bool VectorExport::end()
+{
+    switch (m_format)
+    {
+    case VectorExportFormat_SVG:
+        if (m_groupOpened)
+            write("</g>\n");
+        write("</svg>\n");
+        break;
+    case VectorExportFormat_EPS:
+        write("showpage\n");
+        write("%%EOF\n");
+        break;
+    case VectorExportFormat_PDF:
+    {
+        qint64 length = position() - m_streamStart;
+        write("endstream\nendobj\n");
+        beginObject();
+        write(QByteArray::number(length) + "\nendobj\n");
+
+        qint64 xref = position();
+        write("xref\n0 " + QByteArray::number(m_objectOffsets.count() + 1) + "\n");
+        write("0000000000 65535 f \n");
+        foreach (qint64 offset, m_objectOffsets)
+            write(QByteArray::number(offset).rightJustified(10, '0') + " 00000 n \n");
+        write("trailer\n<< /Size " + QByteArray::number(m_objectOffsets.count() + 1) + " /Root 1 0 R >>\n");
+        write("startxref\n" + QByteArray::number(xref) + "\n%%EOF\n");
+    }
+        break;
+    }
+
+    flush();
+    bool ok = (m_file.error() == QFile::NoError);
+    m_file.close();
+
+    return ok;
+}
+
+void VectorExport::setColor(const QColor &color)
+{
+    if (color == m_color && !m_colorChanged)
+        return;
+
+    m_color = color;
+    m_colorChanged = true;
+}
+
+void VectorExport::drawRectangle(double x, double y, double w, double h)
+{
+    applyColor();
+
+    switch (m_format)
+    {
+    case VectorExportFormat_SVG:
+        write("<rect x=\"" + number(x) + "\" y=\"" + number(m_height - y - h) +
+              "\" width=\"" + number(w) + "\" height=\"" + number(h) + "\"/>\n");
+        break;
+    case VectorExportFormat_EPS:
+        write(number(x) + " " + number(y) + " " + number(w) + " " + number(h) + " r\n");
+        break;
+    case VectorExportFormat_PDF:
+        write(number(x) + " " + number(y) + " " + number(w) + " " + number(h) + " re f\n");
+        break;
+    }
+}
+
+void VectorExport::drawDisc(double x, double y, double radius)
+{
+    applyColor();
+
+    switch (m_format)
+    {
+    case VectorExportFormat_SVG:
+        write("<circle cx=\"" + number(x) + "\" cy=\"" + number(m_height - y) + "\" r=\"" + number(radius) + "\"/>\n");
+        break;
+    case VectorExportFormat_EPS:
+        write(number(x) + " " + number(y) + " " + number(radius) + " d\n");
+        break;
+    case VectorExportFormat_PDF:
+    {
+        double k = CIRCLE_KAPPA * radius;
+
+        QByteArray data;
+        data.reserve(256);
+        data += number(x + radius) + " " + number(y) + " m\n";
+        data += number(x + radius) + " " + number(y + k) + " " + number(x + k) + " " + number(y + radius) + " " + number(x) + " " + number(y + radius) + " c\n";
+        data += number(x - k) + " " + number(y + radius) + " " + number(x - radius) + " " + number(y + k) + " " + number(x - radius) + " " + number(y) + " c\n";
+        data += number(x - radius) + " " + number(y - k) + " " + number(x - k) + " " + number(y - radius) + " " + number(x) + " " + number(y - radius) + " c\n";
+        data += number(x + k) + " " + number(y - radius) + " " + number(x + radius) + " " + number(y - k) + " " + number(x + radius) + " " + number(y) + " c f\n";
+        write(data);
+    }
+        break;
+    }
+}
+
+void VectorExport::applyColor()
+{
+    if (!m_colorChanged)
+        return;
+
+    m_colorChanged = false;
+
+    switch (m_format)
+    {
+    case VectorExportFormat_SVG:
+        // primitives with the same color share one group
+        if (m_groupOpened)
+            write("</g>\n");
+        write("<g fill=\"" + m_color.name().toAscii() + "\">\n");
+        m_groupOpened = true;
+        break;
+    case VectorExportFormat_EPS:
+        write(number(m_color.redF()) + " " + number(m_color.greenF()) + " " + number(m_color.blueF()) + " c\n");
+        break;
+    case VectorExportFormat_PDF:
+        write(number(m_color.redF()) + " " + number(m_color.greenF()) + " " + number(m_color.blueF()) + " rg\n");
+        break;
+    }
+}
+
+void VectorExport::beginObject()
+{
+    m_objectOffsets.append(position());
+    write(QByteArray::number(m_objectOffsets.count()) + " 0 obj\n");
+}
+
+void VectorExport::write(const QByteArray &data)
+{
+    m_buffer.append(data);
+    if (m_buffer.size() >= BUFFER_SIZE)
+        flush();
+}
+
+void VectorExport::flush()
+{
+    if (m_buffer.isEmpty())
+        return;
+
+    m_file.write(m_buffer);
+    m_written += m_buffer.size();
+    m_buffer.clear();
+    m_buffer.reserve(BUFFER_SIZE);
+}
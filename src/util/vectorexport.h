@@ -0,0 +1,72 @@
+// This file is part of Agros2D.
+//
+// Agros2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Agros2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Agros2D.  If not, see <http://www.gnu.org/licenses/>.
+//
+// hp-FEM group (http://hpfem.org/)
+// University of Nevada, Reno (UNR) and University of West Bohemia, Pilsen
+// Email: agros2d@googlegroups.com, home page: http://hpfem.org/agros2d/
+
+#ifndef UTIL_VECTOREXPORT_H
+#define UTIL_VECTOREXPORT_H
+
+#include <QtGui>
+
+enum VectorExportFormat
+{
+    VectorExportFormat_SVG,
+    VectorExportFormat_EPS,
+    VectorExportFormat_PDF
+};
+
+/// streaming writer of flat 2D primitives (window coordinates, origin in the lower left corner)
+/// primitives are written immediately, the output is buffered in blocks and never kept whole in memory
+class VectorExport
+{
+public:
+    VectorExport(VectorExportFormat format, int width, int height);
+    ~VectorExport();
+
+    bool begin(const QString &fileName);
+    bool end();
+
+    void setColor(const QColor &color);
+    void drawRectangle(double x, double y, double w, double h);
+    void drawDisc(double x, double y, double radius);
+
+private:
+    VectorExportFormat m_format;
+    int m_width;
+    int m_height;
+
+    QFile m_file;
+    QByteArray m_buffer;
+    qint64 m_written;
+
+    QColor m_color;
+    bool m_colorChanged;
+    bool m_groupOpened;
+
+    // pdf
+    QList<qint64> m_objectOffsets;
+    qint64 m_streamStart;
+
+    void write(const QByteArray &data);
+    void flush();
+    inline qint64 position() const { return m_written + m_buffer.size(); }
+
+    void applyColor();
+    void beginObject();
+};
+
+#endif // UTIL_VECTOREXPORT_H